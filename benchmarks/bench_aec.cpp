@@ -0,0 +1,103 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark everything in ANSI Escape Codes.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <format>
+#include <sstream>
+#include <string>
+
+#include "alcelin_ansi_escape_codes.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+using namespace aec_operators;
+
+/**
+ *  @brief  Benchmark AEC.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_aec(bench::suite &suite) -> void
+{
+    // Volatile to prevent constant folding
+    volatile unsigned char color = 196;
+    volatile int           n     = 5;
+
+    suite.run("aec::sgr", "single", 0, [&]() { return aec::sgr("1;31"); });
+    suite.run("aec::combine", "single", 0, [&]() {
+        return aec::combine(aec::bold, aec::red);
+    });
+    suite.run("aec::color", "single", 0, [&]() { return aec::color(color); });
+    suite.run("aec::color_bg", "single", 0, [&]() {
+        return aec::color_bg(color);
+    });
+    suite.run("aec::color(rgb)", "single", 0, [&]() {
+        return aec::color(color, color, color);
+    });
+    suite.run("aec::color_bg(rgb)", "single", 0, [&]() {
+        return aec::color_bg(color, color, color);
+    });
+    suite.run("aec::cuu", "single", 0, [&]() { return aec::cuu(n); });
+    suite.run("aec::cud", "single", 0, [&]() { return aec::cud(n); });
+    suite.run("aec::cuf", "single", 0, [&]() { return aec::cuf(n); });
+    suite.run("aec::cub", "single", 0, [&]() { return aec::cub(n); });
+    suite.run("aec::cha", "single", 0, [&]() { return aec::cha(n); });
+    suite.run("aec::cup", "single", 0, [&]() { return aec::cup(n, n); });
+
+    // The other operators are aliases of operator+
+    suite.run("aec_operators::operator+", "single", 0, [&]() {
+        return aec::bold + aec::strike + aec::bright_red;
+    });
+
+    for (auto [name, size] : bench::sizes)
+    {
+        std::string text = bench::make_text(size);
+
+        suite.run("aec::aec_t::operator()", name, size, [&]() {
+            return aec::bold(text);
+        });
+        suite.run("std::formatter<aec_t>", name, size, [&]() {
+            return std::format("{}{}{}", aec::bold, text, ~aec::bold);
+        });
+        suite.run("aec_operators::operator<<", name, size, [&]() {
+            std::ostringstream stream;
+            stream << aec::bold << text << ~aec::bold;
+            return stream.str();
+        });
+    }
+}
@@ -0,0 +1,172 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark everything in Custom Containers.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "alcelin_custom_containers.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief   Sum every element with indices up to twice the container's size,
+ *           so half the accesses are out of bounds.
+ *
+ *  @tparam  container  Boundless container type.
+ *  @param   ctr        Container.
+ *  @return  Sum of accessed elements.
+ */
+template<typename container>
+[[nodiscard]] auto sum_boundless(const container &ctr) -> long long
+{
+    long long sum = 0;
+    for (std::size_t i = 0; i < ctr.size() * 2; i++) sum += ctr[i];
+    return sum;
+}
+
+/**
+ *  @brief   Sum every element using @c at , with indices up to twice the
+ *           container's size.
+ *
+ *  @tparam  container  Boundless container type.
+ *  @param   ctr        Container.
+ *  @return  Sum of accessed elements.
+ */
+template<typename container>
+[[nodiscard]] auto sum_boundless_at(container &ctr) -> long long
+{
+    long long sum = 0;
+    for (std::size_t i = 0; i < ctr.size() * 2; i++) sum += ctr.at(i);
+    return sum;
+}
+
+/**
+ *  @brief  Benchmark CC.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_cc(bench::suite &suite) -> void
+{
+    for (auto [name, size] : bench::sizes)
+    {
+        std::vector<int>          numbers = bench::make_numbers(size);
+        std::string               text    = bench::make_text(size);
+        cc::boundless_vector<int> vector(numbers.begin(), numbers.end());
+        cc::boundless_span<int>   span(numbers.data(), numbers.size());
+        cc::boundless_string      string(text.begin(), text.end());
+        cc::boundless_string_view view(string.data(), string.size());
+        std::size_t               bytes = size * sizeof (int);
+
+        // Baseline for the boundless containers, accessing only in bounds
+        suite.run("std::vector::operator[]", name, bytes, [&]() {
+            long long sum = 0;
+            for (std::size_t i = 0; i < numbers.size(); i++) sum += numbers[i];
+            return sum;
+        });
+
+        suite.run("cc::boundless_access", name, bytes, [&]() {
+            long long sum = 0;
+            for (std::size_t i = 0; i < size * 2; i++)
+            {
+                sum += cc::boundless_access(numbers, i);
+            }
+            return sum;
+        });
+        suite.run("cc::boundless_vector::operator[]", name, bytes, [&]() {
+            return sum_boundless(vector);
+        });
+        suite.run("cc::boundless_vector::at", name, bytes, [&]() {
+            return sum_boundless_at(vector);
+        });
+        suite.run("cc::boundless_vector::front/back", name, bytes, [&]() {
+            return vector.front() + vector.back();
+        });
+        suite.run("cc::boundless_span::operator[]", name, bytes, [&]() {
+            return sum_boundless(span);
+        });
+        suite.run("cc::boundless_span::at", name, bytes, [&]() {
+            return sum_boundless_at(span);
+        });
+        suite.run("cc::boundless_string::operator[]", name, size, [&]() {
+            return sum_boundless(string);
+        });
+        suite.run("cc::boundless_string::at", name, size, [&]() {
+            return sum_boundless_at(string);
+        });
+        suite.run("cc::boundless_string_view::operator[]", name, size, [&]() {
+            return sum_boundless(view);
+        });
+        suite.run("cc::boundless_string_view::at", name, size, [&]() {
+            return sum_boundless_at(view);
+        });
+    }
+
+    cc::boundless_array<int, 1024> array = {};
+    for (std::size_t i = 0; i < array.size(); i++) array[i] = (int)i;
+
+    suite.run("cc::boundless_array::operator[]", "medium",
+        array.size() * sizeof (int), [&]() { return sum_boundless(array); });
+    suite.run("cc::boundless_array::at", "medium",
+        array.size() * sizeof (int), [&]() { return sum_boundless_at(array); });
+
+    enum class enumerator {
+        unknown = -1,
+        zeroth,
+        first,
+        second,
+        third,
+        max
+    };
+
+    cc::erray<enumerator, int> erray = { 0, 1, 2, 3 };
+
+    suite.run("cc::enumerated_array::operator[]", "small",
+        erray.size() * sizeof (int), [&]() {
+        long long sum = 0;
+        for (int i = 0; i < std::to_underlying(enumerator::max); i++)
+        {
+            sum += erray[(enumerator)i];
+        }
+        return sum;
+    });
+}
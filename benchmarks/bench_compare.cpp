@@ -0,0 +1,173 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Compare two benchmark runs for regressions.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <exception>
+#include <format>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "comparer.hpp"
+
+/**
+ *  @brief   Parse a decimal number from a command line argument.
+ *
+ *  @param   argument  Argument to parse.
+ *  @return  Parsed number.
+ */
+[[nodiscard]] auto parse_decimal(std::string_view argument) -> double
+{
+    double number = 0.0;
+    auto [end, error] = std::from_chars(argument.data(),
+        argument.data() + argument.size(), number);
+    if (error != std::errc() || end != argument.data() + argument.size())
+    {
+        throw std::invalid_argument(std::format("Invalid number {}",
+            argument));
+    }
+    return number;
+}
+
+/**
+ *  @brief   Compare two benchmark runs and report the regressions.
+ *
+ *  Usage: alcelin_bench_compare baseline.json current.json
+ *                               [--threshold percent] [--alpha level]
+ *
+ *  @return  Zero if nothing regressed, one if something regressed, two on
+ *           error.
+ */
+auto main(int argc, char **argv) -> int try
+{
+    std::vector<std::string_view> files = {};
+    double threshold = 5.0;
+    double alpha     = 0.01;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string_view argument = argv[i];
+        if (!argument.starts_with("--"))
+        {
+            files.emplace_back(argument);
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument(std::format(
+                "Missing value for argument {}", argument));
+        }
+
+        std::string_view value = argv[++i];
+        if (argument == "--threshold") threshold = parse_decimal(value);
+        else if (argument == "--alpha") alpha = parse_decimal(value);
+        else
+        {
+            throw std::invalid_argument(std::format("Unknown argument {}",
+                argument));
+        }
+    }
+
+    if (files.size() != 2)
+    {
+        throw std::invalid_argument("Expected baseline and current JSON "
+            "files");
+    }
+
+    auto baseline    = bench::read_results(files[0]);
+    auto current     = bench::read_results(files[1]);
+    auto comparisons = bench::compare(baseline, current, threshold / 100.0,
+        alpha);
+
+    std::size_t regressions  = 0;
+    std::size_t improvements = 0;
+    std::size_t missing      = 0;
+    for (auto &compared : comparisons)
+    {
+        if (compared.result == bench::verdict::regressed) regressions++;
+        if (compared.result == bench::verdict::improved) improvements++;
+        if (compared.result == bench::verdict::missing) missing++;
+    }
+
+    auto print_verdicts = [&](bench::verdict result) {
+        std::println("{}:", bench::to_string(result));
+        for (auto &compared : comparisons)
+        {
+            if (compared.result != result) continue;
+            if (result == bench::verdict::missing)
+            {
+                std::println("  {:<44} {:<16} {:>12.1f} ns/op in baseline",
+                    compared.name, compared.size, compared.baseline);
+                continue;
+            }
+            std::println("  {:<44} {:<16} {:>12.1f} -> {:>12.1f} ns/op "
+                         "{:>+8.1f}% p={:.4f}", compared.name, compared.size,
+                compared.baseline, compared.current, compared.change * 100.0,
+                compared.p_value);
+        }
+    };
+
+    if (regressions) print_verdicts(bench::verdict::regressed);
+    if (improvements) print_verdicts(bench::verdict::improved);
+    if (missing) print_verdicts(bench::verdict::missing);
+
+    std::size_t compared = comparisons.size() - missing;
+    std::println("{} compared, {} regressed, {} improved (threshold {}%, "
+                 "alpha {}), {} missing, {} only in current", compared,
+        regressions, improvements, threshold, alpha, missing,
+        current.size() - compared);
+
+    return regressions != 0;
+}
+catch (const std::exception &e)
+{
+    std::println(stderr, "Exception occurred during comparison: {}",
+        e.what());
+    return 2;
+}
+catch (...)
+{
+    std::println(stderr, "Unknown exception occurred during comparison");
+    return 2;
+}
@@ -0,0 +1,99 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark CPU Dispatch's kernels.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <format>
+#include <string>
+#include <string_view>
+
+#include "alcelin_cpu_dispatch.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief  Benchmark CPU's kernels of every supported instruction set.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_cpu(bench::suite &suite) -> void
+{
+    constexpr std::string_view whitespace = " \t\r\n\f\v\b";
+
+    for (auto [name, size] : bench::sizes)
+    {
+        std::string text   = bench::make_text(size);
+        std::string spaces = std::string(size, ' ') + "x";
+        std::string output = text;
+
+        for (int i = 0; i <= (int)cpu::detected(); i++)
+        {
+            auto &kernels = cpu::kernels_for((cpu::isa)i);
+            auto  isa     = cpu::to_string((cpu::isa)i);
+
+            suite.run(std::format("cpu::find_first_of[{}]", isa), name, size,
+                [&]() {
+                    return kernels.find_first_of(text.data(), text.size(),
+                        "@#", 2);
+                });
+            suite.run(std::format("cpu::find_first_not_of[{}]", isa), name,
+                size, [&]() {
+                    return kernels.find_first_not_of(spaces.data(),
+                        spaces.size(), whitespace.data(), whitespace.size());
+                });
+            suite.run(std::format("cpu::find_last_not_of[{}]", isa), name,
+                size, [&]() {
+                    return kernels.find_last_not_of(spaces.data(), size,
+                        whitespace.data(), whitespace.size());
+                });
+            suite.run(std::format("cpu::to_lower[{}]", isa), name, size,
+                [&]() {
+                    kernels.to_lower(output.data(), text.data(), size);
+                    return output[0];
+                });
+            suite.run(std::format("cpu::to_upper[{}]", isa), name, size,
+                [&]() {
+                    kernels.to_upper(output.data(), text.data(), size);
+                    return output[0];
+                });
+            suite.run(std::format("cpu::crc32c[{}]", isa), name, size, [&]() {
+                return kernels.crc32c(0, text.data(), text.size());
+            });
+        }
+    }
+}
@@ -0,0 +1,217 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark everything in Container Utilities.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <utility>
+#include <vector>
+
+#include "alcelin_container_utilities.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+using namespace cu_operators;
+
+/**
+ *  @brief   Make deterministic pseudo-random ids in range [0, 2^20).
+ *
+ *  @param   size  Number of ids.
+ *  @param   seed  Seed, different seeds make different ids.
+ *  @return  Ids.
+ */
+[[nodiscard]] static auto make_ids(std::size_t size, std::uint32_t seed)
+    -> std::vector<int>
+{
+    std::vector<int> ids(size);
+    std::uint32_t    state = 2463534242u ^ seed;
+    for (auto &id : ids)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        id     = state >> 12;
+    }
+    return ids;
+}
+
+/**
+ *  @brief  Benchmark CU's @c filter_out_occ strategies across value set sizes
+ *          to find the crossover points of @c cu::filter_linear_max .
+ *  @param  suite  Suite to run benchmarks in.
+ */
+static auto bench_cu_filter_strategies(bench::suite &suite) -> void
+{
+    constexpr std::array strategies = {
+        cu::filter_strategy::automatic,
+        cu::filter_strategy::linear,
+        cu::filter_strategy::sorted,
+        cu::filter_strategy::hashed
+    };
+
+    std::vector<int> ids    = make_ids(4096, 1);
+    std::vector<int> sorted = ids;
+    std::ranges::sort(sorted);
+
+    for (std::size_t count : { 4, 8, 16, 32, 64, 256, 4096, 65536 })
+    {
+        std::vector<int> values        = make_ids(count, 2);
+        std::vector<int> sorted_values = values;
+        std::ranges::sort(sorted_values);
+
+        auto        values_name = std::format("{} values", count);
+        std::size_t bytes       = ids.size() * sizeof (int);
+
+        for (auto strategy : strategies)
+        {
+            // Linear is quadratic, and its trend is clear by then
+            if (strategy == cu::filter_strategy::linear && count > 4096)
+            {
+                continue;
+            }
+
+            auto strategy_name = cu::to_string(strategy);
+            suite.run(std::format("cu::filter_out_occ[{}]", strategy_name),
+                values_name, bytes, [&]() {
+                    return cu::filter_out_occ(ids, values, strategy);
+                });
+            suite.run(std::format("cu::filter_out_occ[{}, sorted input]",
+                strategy_name), values_name, bytes, [&]() {
+                    return cu::filter_out_occ(sorted, sorted_values,
+                        strategy);
+                });
+        }
+    }
+}
+
+/**
+ *  @brief  Benchmark CU.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_cu(bench::suite &suite) -> void
+{
+    for (auto [name, size] : bench::sizes)
+    {
+        std::vector<int>              ctr      = bench::make_numbers(size);
+        std::vector<int>              pattern  = { 3, 10 };
+        std::vector<int>              values   = { 3, 7, 11 };
+        std::vector<std::vector<int>> patterns = { { 3, 10 }, { 1, 8 } };
+        std::size_t                   bytes    = size * sizeof (int);
+
+        suite.run("cu::subordinate", name, bytes, [&]() {
+            return cu::subordinate(ctr, 0, size / 2);
+        });
+        suite.run("cu::slice", name, bytes, [&]() {
+            return cu::slice(ctr, 0, size / 2);
+        });
+        suite.run("cu::combine", name, bytes, [&]() {
+            return cu::combine(ctr, ctr);
+        });
+        suite.run("cu::combine(value)", name, bytes, [&]() {
+            return cu::combine(ctr, 1);
+        });
+        suite.run("cu::filter_out_seq", name, bytes, [&]() {
+            return cu::filter_out_seq(ctr, pattern);
+        });
+        suite.run("cu::filter_out_occ", name, bytes, [&]() {
+            return cu::filter_out_occ(ctr, values);
+        });
+        suite.run("cu::filter_out_occ_seq", name, bytes, [&]() {
+            return cu::filter_out_occ_seq(ctr, patterns);
+        });
+        suite.run("cu::filter_out", name, bytes, [&]() {
+            return cu::filter_out(ctr, 3);
+        });
+        suite.run("cu::repeat", name, bytes, [&]() {
+            return cu::repeat(ctr, 4);
+        });
+        suite.run("cu::repeat(fraction)", name, bytes, [&]() {
+            return cu::repeat(ctr, 2.5);
+        });
+        suite.run("cu::split_seq", name, bytes, [&]() {
+            return cu::split_seq(ctr, pattern);
+        });
+        suite.run("cu::split_occ", name, bytes, [&]() {
+            return cu::split_occ(ctr, values);
+        });
+        suite.run("cu::split_occ_seq", name, bytes, [&]() {
+            return cu::split_occ_seq(ctr, patterns);
+        });
+        suite.run("cu::split", name, bytes, [&]() {
+            return cu::split(ctr, 3);
+        });
+        suite.run("cu::split_seq_flat", name, bytes, [&]() {
+            return cu::split_seq_flat(ctr, pattern);
+        });
+        suite.run("cu::split_occ_flat", name, bytes, [&]() {
+            return cu::split_occ_flat(ctr, values);
+        });
+        suite.run("cu::split_occ_seq_flat", name, bytes, [&]() {
+            return cu::split_occ_seq_flat(ctr, patterns);
+        });
+        suite.run("cu::split_flat", name, bytes, [&]() {
+            return cu::split_flat(ctr, 3);
+        });
+        suite.run("cu::replace_seq", name, bytes, [&]() {
+            return cu::replace_seq(ctr, pattern, values);
+        });
+        suite.run("cu::replace_occ", name, bytes, [&]() {
+            return cu::replace_occ(ctr, values, pattern);
+        });
+
+        // Operators forward to the functions above, compound operators grow
+        // or consume their operand and are thus not benchmarked
+        suite.run("cu_operators::operator+", name, bytes, [&]() {
+            return ctr + ctr;
+        });
+        suite.run("cu_operators::operator-", name, bytes, [&]() {
+            return ctr - pattern;
+        });
+        suite.run("cu_operators::operator*", name, bytes, [&]() {
+            return ctr * 4;
+        });
+        suite.run("cu_operators::operator/", name, bytes, [&]() {
+            return ctr / pattern;
+        });
+    }
+
+    bench_cu_filter_strategies(suite);
+}
@@ -0,0 +1,122 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark everything in File Utilities.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+#include "alcelin_file_utilities.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief   Benchmark File's chunk functions with a value of @c size bytes.
+ *
+ *  @tparam  size   Size of value in bytes.
+ *  @param   suite  Suite to run benchmarks in.
+ *  @param   name   Name of the input size.
+ */
+template<std::size_t size>
+auto bench_file_chunks(bench::suite &suite, std::string_view name) -> void
+{
+    std::array<unsigned char, size> value = {};
+    for (std::size_t i = 0; i < size; i++) value[i] = (unsigned char)i;
+
+    file::sd_chunk chunk = file::to_sd_chunk(value);
+
+    std::stringstream stream;
+    file::write_chunk(stream, chunk);
+    std::string written = stream.str();
+
+    suite.run("file::to_sd_chunk", name, size, [&]() {
+        return file::to_sd_chunk(value);
+    });
+    suite.run("file::from_sd_chunk", name, size, [&]() {
+        return file::from_sd_chunk<decltype(value)>(chunk);
+    });
+    suite.run("file::write_chunk", name, size, [&]() {
+        std::ostringstream output;
+        file::write_chunk(output, chunk);
+        return output.tellp();
+    });
+    suite.run("file::read_chunk", name, size, [&]() {
+        std::istringstream input(written);
+        return file::read_chunk(input);
+    });
+    suite.run("file::write_data", name, size, [&]() {
+        std::ostringstream output;
+        file::write_data(output, value);
+        return output.tellp();
+    });
+    suite.run("file::read_data", name, size, [&]() {
+        std::istringstream input(written);
+        return file::read_data<decltype(value)>(input);
+    });
+}
+
+/**
+ *  @brief  Benchmark File.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_file(bench::suite &suite) -> void
+{
+    constexpr std::string_view filename = "bench_file_read_all.txt";
+
+    for (auto [name, size] : bench::sizes)
+    {
+        {
+            std::ofstream outfile((std::string(filename)));
+            outfile << bench::make_text(size);
+        }
+
+        suite.run("file::read_all", name, size, [&]() {
+            return file::read_all(filename);
+        });
+    }
+    std::remove(filename.data());
+
+    bench_file_chunks<bench::sizes[0].size>(suite, bench::sizes[0].name);
+    bench_file_chunks<bench::sizes[1].size>(suite, bench::sizes[1].name);
+    bench_file_chunks<bench::sizes[2].size>(suite, bench::sizes[2].name);
+}
@@ -0,0 +1,317 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark everything in Prop.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <format>
+#include <functional>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "alcelin_property.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief  Value too large to be lock-free, stored in a seqlock.
+ */
+struct bench_large_value {
+
+    /**
+     *  @brief  Data of the value.
+     */
+    std::array<long long, 4> data = {};
+};
+
+/**
+ *  @brief   Benchmark reading an atomic observable while other threads
+ *           access it.
+ *
+ *  @tparam  type     Type of value.
+ *  @param   suite    Suite to run benchmarks in.
+ *  @param   name     Name of the benchmark.
+ *  @param   readers  Number of background threads reading.
+ *  @param   writers  Number of background threads writing.
+ */
+template<typename type>
+auto bench_atomic_observable(
+    bench::suite    &suite,
+    std::string_view name,
+    std::size_t      readers,
+    std::size_t      writers
+) -> void
+{
+    prop::atomic_observable<type> observable;
+    std::atomic<bool>             stop = false;
+    std::vector<std::thread>      threads;
+
+    for (std::size_t i = 0; i < readers; i++)
+    {
+        threads.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                bench::do_not_optimize(observable.get());
+            }
+        });
+    }
+    for (std::size_t i = 0; i < writers; i++)
+    {
+        threads.emplace_back([&]() {
+            type value = {};
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                observable.set(value);
+            }
+        });
+    }
+
+    suite.run(name, std::format("{}r/{}w", readers, writers), sizeof (type),
+        [&]() { return observable.get(); });
+
+    stop = true;
+    for (auto &thread : threads) thread.join();
+}
+
+/**
+ *  @brief  Benchmark Prop.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_prop(bench::suite &suite) -> void
+{
+    int value = 0;
+
+    // Callables in properties, inline storage against std::function
+    prop::property<int> property = {
+        [&]() { return value; },
+        [&](const int &v) { value = v; }
+    };
+    prop::property<int, std::function<int()>, std::function<void(const int &)>>
+    function_property = {
+        [&]() { return value; },
+        [&](const int &v) { value = v; }
+    };
+
+    suite.run("prop::property::get", "inplace_function", sizeof (int),
+        [&]() { return property.get(); });
+    suite.run("prop::property::get", "std::function", sizeof (int),
+        [&]() { return function_property.get(); });
+    suite.run("prop::property::set", "inplace_function", sizeof (int),
+        [&]() { property.set(value + 1); });
+    suite.run("prop::property::set", "std::function", sizeof (int),
+        [&]() { function_property.set(value + 1); });
+    suite.run("prop::property::operator+=", "inplace_function", sizeof (int),
+        [&]() { property += 1; });
+
+    // Deduced from the lambdas, calls are inlined to plain field access
+    prop::property deduced_property(
+        [&]() { return value; },
+        [&](const int &v) { value = v; });
+
+    suite.run("prop::property::get", "deduced", sizeof (int),
+        [&]() { return deduced_property.get(); });
+    suite.run("prop::property::set", "deduced", sizeof (int),
+        [&]() { deduced_property.set(value + 1); });
+    suite.run("prop::property::operator+=", "deduced", sizeof (int),
+        [&]() { deduced_property += 1; });
+
+    prop::inplace_function<int(int)> inplace = [&](int v) { return v + value; };
+    std::function<int(int)>          function = [&](int v) { return v + value; };
+
+    suite.run("prop::inplace_function::operator()", "single", 0,
+        [&]() { return inplace(1); });
+    suite.run("std::function::operator()", "single", 0,
+        [&]() { return function(1); });
+    suite.run("prop::inplace_function(copy)", "single", 0,
+        [&]() { return prop::inplace_function<int(int)>(inplace); });
+    suite.run("prop::inplace_function(move)", "single", 0, [&]() {
+        auto moved = std::move(inplace);
+        inplace    = std::move(moved);
+    });
+
+    // Observables
+    prop::observable<int> observable = 0;
+    suite.run("prop::observable::get", "single", sizeof (int),
+        [&]() { return observable.get(); });
+    suite.run("prop::observable::set", "0 slots", sizeof (int),
+        [&]() { observable = observable.get() + 1; });
+
+    observable.changed.connect([&](const int &v) { value = v; });
+    suite.run("prop::observable::set", "1 slot", sizeof (int),
+        [&]() { observable = observable.get() + 1; });
+    suite.run("prop::observable::operator+=", "1 slot", sizeof (int),
+        [&]() { observable += 1; });
+
+    prop::observable<std::string> string = std::string(1024, 'a');
+    suite.run("prop::observable<string>::operator+=", "medium", 1,
+        [&]() {
+        string += "a";
+        if (string.get().size() > 2048) string = std::string(1024, 'a');
+    });
+
+    // Signals
+    for (std::size_t slots : { 0uz, 1uz, 10uz, 1000uz })
+    {
+        prop::signal<int> signal;
+        for (std::size_t i = 0; i < slots; i++)
+        {
+            signal.connect([&](int v) { value += v; });
+        }
+
+        suite.run("prop::signal::emit", std::format("{} slots", slots), 0,
+            [&]() { signal.emit(1); });
+    }
+
+    prop::signal<int> signal;
+    suite.run("prop::signal::connect/disconnect", "single", 0, [&]() {
+        signal.disconnect(signal.connect([&](int v) { value += v; }));
+    });
+
+    // Batches
+    std::vector<prop::observable<int>> observables(100);
+    for (auto &each : observables)
+    {
+        each.changed.connect([&](const int &v) { value += v; });
+    }
+
+    suite.run("prop::observable::set", "100 unbatched", 0, [&]() {
+        for (auto &each : observables)
+        {
+            each = 1;
+            each = 2;
+        }
+    });
+    suite.run("prop::batch", "100 batched", 0, [&]() {
+        prop::batch batch;
+        for (auto &each : observables)
+        {
+            each = 1;
+            each = 2;
+        }
+    });
+
+    // Computed properties
+    prop::observable<int> width  = 2;
+    prop::observable<int> height = 3;
+    prop::computed        area([&]() { return width * height; });
+
+    suite.run("prop::computed::get", "hit", sizeof (int),
+        [&]() { return area.get(); });
+    suite.run("prop::computed::get", "miss", sizeof (int), [&]() {
+        width = width.get() + 1;
+        return area.get();
+    });
+
+    // Atomic observables, contended by background threads
+    std::size_t threads = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+    bench_atomic_observable<int>(suite, "prop::atomic_observable<int>::get",
+        0, 0);
+    bench_atomic_observable<int>(suite, "prop::atomic_observable<int>::get",
+        threads, 0);
+    bench_atomic_observable<int>(suite, "prop::atomic_observable<int>::get",
+        0, 1);
+    bench_atomic_observable<bench_large_value>(suite,
+        "prop::atomic_observable<large>::get", 0, 0);
+    bench_atomic_observable<bench_large_value>(suite,
+        "prop::atomic_observable<large>::get", threads, 0);
+    bench_atomic_observable<bench_large_value>(suite,
+        "prop::atomic_observable<large>::get", 0, 1);
+
+    // Observable containers
+    for (auto [name, size] : bench::sizes)
+    {
+        prop::observable_vector<int> vector;
+        vector.changed.connect([&](const prop::vector_change &change) {
+            value += change.count;
+        });
+
+        suite.run("prop::observable_vector::push_back", name,
+            size * sizeof (int), [&]() {
+            vector.clear();
+            for (std::size_t i = 0; i < size; i++) vector.push_back((int)i);
+        });
+
+        prop::observable_map<int, int> map;
+        map.changed.connect([&](const prop::map_change<int> &) {
+            value++;
+        });
+
+        suite.run("prop::observable_map::set", name, size * sizeof (int),
+            [&]() {
+            for (std::size_t i = 0; i < size; i++) map.set((int)i, (int)i);
+        });
+    }
+
+    // Registry and journal
+    std::vector<prop::observable<int>> settings(64);
+    prop::registry                     registry;
+    for (std::size_t i = 0; i < settings.size(); i++)
+    {
+        registry.add(std::format("setting_{}", i), settings[i]);
+    }
+
+    suite.run("prop::registry::save", "64 properties", 64 * sizeof (int),
+        [&]() {
+        std::ostringstream output;
+        return registry.save(output);
+    });
+    suite.run("prop::registry::autosave", "1 dirty of 64", sizeof (int),
+        [&]() {
+        settings[0] = settings[0].get() + 1;
+        std::ostringstream output;
+        return registry.autosave(output);
+    });
+    suite.run("prop::registry::find", "64 properties", 0,
+        [&]() { return registry.find("setting_42"); });
+
+    prop::observable<int> position = 0;
+    prop::journal         journal(64 * 1024);
+    journal.track(position);
+
+    suite.run("prop::journal::record", "single", sizeof (int),
+        [&]() { position = position.get() + 1; });
+    suite.run("prop::journal::undo/redo", "single", sizeof (int), [&]() {
+        journal.undo();
+        journal.redo();
+    });
+}
@@ -0,0 +1,207 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark everything in String Manipulators.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "alcelin_string_manipulators.hpp"
+#include "bencher.hpp"
+
+using namespace alcelin;
+using namespace sm_operators;
+
+/**
+ *  @brief  Benchmark SM.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_sm(bench::suite &suite) -> void
+{
+    for (auto [name, size] : bench::sizes)
+    {
+        std::string              text    = bench::make_text(size);
+        std::string              padded  = "  \t" + text + "\n  ";
+        std::string              indented = std::string(64, ' ') + text
+                                          + std::string(64, ' ');
+        std::string              upper   = sm::to_upper(text);
+        std::vector<int>         numbers = bench::make_numbers(size);
+        std::vector<char>        chars(text.begin(), text.end());
+        std::vector<std::string> strings = sm::split(text, ' ');
+        std::vector<std::string> patterns = { "or", "it" };
+        sm::replace_table        table    = {
+            { "or", "<or>" }, { "it", "<it>" }, { "ipsum", "<ipsum>" }
+        };
+        std::size_t              bytes    = size;
+
+        suite.run("sm::to_string(numbers)", name, size * sizeof (int), [&]() {
+            return sm::to_string(numbers);
+        });
+        suite.run("sm::to_string(chars)", name, bytes, [&]() {
+            return sm::to_string(chars);
+        });
+        suite.run("sm::to_string(strings)", name, bytes, [&]() {
+            return sm::to_string(strings);
+        });
+        suite.run("sm::chars_to_string", name, bytes, [&]() {
+            return sm::chars_to_string(chars);
+        });
+        suite.run("sm::word_wrap", name, bytes, [&]() {
+            return sm::word_wrap(text, 40);
+        });
+        suite.run("sm::word_wrap(force)", name, bytes, [&]() {
+            return sm::word_wrap(text, 4, true);
+        });
+        suite.run("sm::trim_left", name, bytes, [&]() {
+            return sm::trim_left(padded);
+        });
+        suite.run("sm::trim_right", name, bytes, [&]() {
+            return sm::trim_right(padded);
+        });
+        suite.run("sm::trim", name, bytes, [&]() {
+            return sm::trim(padded);
+        });
+        suite.run("sm::trim(indented)", name, bytes, [&]() {
+            return sm::trim(indented);
+        });
+        suite.run("sm::to_upper", name, bytes, [&]() {
+            return sm::to_upper(text);
+        });
+        suite.run("sm::to_lower", name, bytes, [&]() {
+            return sm::to_lower(upper);
+        });
+        suite.run("sm::is_equal_ins", name, bytes, [&]() {
+            return sm::is_equal_ins(text, upper);
+        });
+        suite.run("sm::filter_out_seq", name, bytes, [&]() {
+            return sm::filter_out_seq(text, "or");
+        });
+        suite.run("sm::filter_out_occ", name, bytes, [&]() {
+            return sm::filter_out_occ(text, "aeiou");
+        });
+        suite.run("sm::filter_out_occ_seq", name, bytes, [&]() {
+            return sm::filter_out_occ_seq(text, patterns);
+        });
+        suite.run("sm::filter_out", name, bytes, [&]() {
+            return sm::filter_out(text, ' ');
+        });
+        suite.run("sm::repeat", name, bytes, [&]() {
+            return sm::repeat(text, 4);
+        });
+        suite.run("sm::split_seq", name, bytes, [&]() {
+            return sm::split_seq(text, ", ");
+        });
+        suite.run("sm::split_occ", name, bytes, [&]() {
+            return sm::split_occ(text, " ,.");
+        });
+        suite.run("sm::split_occ_seq", name, bytes, [&]() {
+            return sm::split_occ_seq(text, patterns);
+        });
+        suite.run("sm::split", name, bytes, [&]() {
+            return sm::split(text, ' ');
+        });
+        suite.run("sm::split_seq_flat", name, bytes, [&]() {
+            return sm::split_seq_flat(text, ", ");
+        });
+        suite.run("sm::split_occ_flat", name, bytes, [&]() {
+            return sm::split_occ_flat(text, " ,.");
+        });
+        suite.run("sm::split_occ_seq_flat", name, bytes, [&]() {
+            return sm::split_occ_seq_flat(text, patterns);
+        });
+        suite.run("sm::split_flat", name, bytes, [&]() {
+            return sm::split_flat(text, ' ');
+        });
+        suite.run("sm::replace_all", name, bytes, [&]() {
+            return sm::replace_all(text, "or", "<or>");
+        });
+        suite.run("sm::replace_all(table)", name, bytes, [&]() {
+            return sm::replace_all(text, table);
+        });
+
+        // Replacing by joining the split pieces, as done before replace_all
+        suite.run("sm::replace_all(split_seq)", name, bytes, [&]() {
+            return sm::to_string(sm::split_seq(text, "or"),
+                [](const std::string &piece) { return piece; }, "<or>");
+        });
+        suite.run("std::formatter<container>", name, size * sizeof (int),
+            [&]() { return std::format("{}", numbers); });
+
+        // Operators forward to the functions above, compound operators grow
+        // or consume their operand and are thus not benchmarked
+        suite.run("sm_operators::operator-", name, bytes, [&]() {
+            return std::string_view(text) - std::string_view("or");
+        });
+        suite.run("sm_operators::operator*", name, bytes, [&]() {
+            return std::string_view(text) * 4;
+        });
+        suite.run("sm_operators::operator/", name, bytes, [&]() {
+            return std::string_view(text) / ' ';
+        });
+    }
+
+    // Volatile to prevent constant folding
+    volatile char lower = 'a';
+    volatile char upper = 'A';
+
+    suite.run("sm::to_string(char)", "single", 1, [&]() {
+        return sm::to_string(lower);
+    });
+    suite.run("sm::to_upper(char)", "single", 1, [&]() {
+        return sm::to_upper(lower);
+    });
+    suite.run("sm::to_lower(char)", "single", 1, [&]() {
+        return sm::to_lower(upper);
+    });
+    suite.run("sm::is_equal_ins(char)", "single", 1, [&]() {
+        return sm::is_equal_ins(lower, upper);
+    });
+
+    // Keyword table split at startup, against split at compile time
+    std::string_view keywords = "if,else,for,while,do,switch,case,return";
+
+    suite.run("sm::split(keywords)", "single", keywords.size(), [&]() {
+        return sm::split(keywords, ',');
+    });
+    suite.run("sm::static_split(keywords)", "single", keywords.size(), [&]() {
+        return sm::static_split<"if,else,for,while,do,switch,case,return",
+            ','>();
+    });
+}
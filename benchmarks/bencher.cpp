@@ -0,0 +1,241 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Benchmark all of Alcelin.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <exception>
+#include <format>
+#include <fstream>
+#include <new>
+#include <print>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "bencher.hpp"
+
+#ifndef ALCELIN_INSTRUMENT_ALLOCS
+
+/**
+ *  @brief   Allocate memory, counting the allocation.
+ *
+ *  Calls the new handler and retries while allocation fails, as the default
+ *  @c operator @c new does.
+ *
+ *  @param   size  Number of bytes to allocate.
+ *  @return  Allocated memory.
+ */
+auto operator new (std::size_t size) -> void *
+{
+    bench::allocations::count.fetch_add(1, std::memory_order_relaxed);
+    bench::allocations::bytes.fetch_add(size, std::memory_order_relaxed);
+
+    if (size == 0) size = 1;
+    while (true)
+    {
+        if (void *memory = std::malloc(size)) return memory;
+
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+/**
+ *  @brief  Free memory allocated by @c operator new .
+ *  @param  memory  Memory to free.
+ */
+auto operator delete (void *memory) noexcept -> void
+{
+    std::free(memory);
+}
+
+/**
+ *  @brief  Free memory allocated by @c operator new , the size is not needed.
+ *  @param  memory  Memory to free.
+ */
+auto operator delete (void *memory, std::size_t) noexcept -> void
+{
+    std::free(memory);
+}
+
+#endif // ALCELIN_INSTRUMENT_ALLOCS
+
+/**
+ *  @brief  Benchmark CU.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_cu(bench::suite &suite) -> void;
+
+/**
+ *  @brief  Benchmark CC.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_cc(bench::suite &suite) -> void;
+
+/**
+ *  @brief  Benchmark SM.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_sm(bench::suite &suite) -> void;
+
+/**
+ *  @brief  Benchmark AEC.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_aec(bench::suite &suite) -> void;
+
+/**
+ *  @brief  Benchmark File.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_file(bench::suite &suite) -> void;
+
+/**
+ *  @brief  Benchmark Prop.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_prop(bench::suite &suite) -> void;
+
+/**
+ *  @brief  Benchmark CPU.
+ *  @param  suite  Suite to run benchmarks in.
+ */
+auto bench_cpu(bench::suite &suite) -> void;
+
+/**
+ *  @brief   Parse a number from a command line argument.
+ *
+ *  @param   argument  Argument to parse.
+ *  @return  Parsed number.
+ */
+[[nodiscard]] auto parse_number(std::string_view argument) -> std::size_t
+{
+    std::size_t number = 0;
+    auto [end, error] = std::from_chars(argument.data(),
+        argument.data() + argument.size(), number);
+    if (error != std::errc() || end != argument.data() + argument.size())
+    {
+        throw std::invalid_argument(std::format("Invalid number {}",
+            argument));
+    }
+    return number;
+}
+
+/**
+ *  @brief   Run all the benchmarks.
+ *
+ *  Usage: alcelin_bench [--filter text] [--repetitions n] [--min-time ms]
+ *                       [--warmup ms] [--json file] [--perf]
+ *
+ *  @return  Zero on success.
+ */
+auto main(int argc, char **argv) -> int try
+{
+    bench::suite suite;
+    std::string  json;
+
+    for (int i = 1; i < argc; i++)
+    {
+        std::string_view argument = argv[i];
+        if (argument == "--perf")
+        {
+            suite.opts.perf = true;
+            continue;
+        }
+
+        if (i + 1 >= argc)
+        {
+            throw std::invalid_argument(std::format(
+                "Missing value for argument {}", argument));
+        }
+
+        std::string_view value = argv[++i];
+        if (argument == "--filter") suite.opts.filter = value;
+        else if (argument == "--repetitions")
+        {
+            suite.opts.repetitions = std::max(parse_number(value), 1uz);
+        }
+        else if (argument == "--min-time")
+        {
+            suite.opts.min_time = std::chrono::milliseconds(
+                parse_number(value));
+        }
+        else if (argument == "--warmup")
+        {
+            suite.opts.warmup = std::chrono::milliseconds(parse_number(value));
+        }
+        else if (argument == "--json") json = value;
+        else
+        {
+            throw std::invalid_argument(std::format("Unknown argument {}",
+                argument));
+        }
+    }
+
+    bench_cu(suite);
+    bench_cc(suite);
+    bench_sm(suite);
+    bench_aec(suite);
+    bench_file(suite);
+    bench_prop(suite);
+    bench_cpu(suite);
+
+    if (!json.empty())
+    {
+        std::ofstream outfile(json);
+        if (!outfile)
+        {
+            throw std::runtime_error(std::format("Failed to open file {}",
+                json));
+        }
+        suite.write_json(outfile);
+    }
+
+    return 0;
+}
+catch (const std::exception &e)
+{
+    std::println(stderr, "Exception occurred during benchmark: {}", e.what());
+    return 1;
+}
@@ -0,0 +1,613 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Micro-benchmark harness for Alcelin.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <format>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <optional>
+#include <print>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "alcelin_allocation_counters.hpp"
+#include "perf_counters.hpp"
+
+/**
+ *  @brief  Micro-benchmark harness for Alcelin.
+ */
+namespace bench {
+
+/**
+ *  @brief  Allocations made by the process, counted by the replaced global
+ *          allocation functions in bencher.cpp.
+ *
+ *  When Alcelin counts allocations itself, the allocation functions of
+ *  @c alcelin_alloc_hooks replace the ones in bencher.cpp and only the current
+ *  thread's allocations are counted.
+ */
+struct allocations {
+
+    /**
+     *  @brief  Number of allocations.
+     */
+    static inline std::atomic<std::size_t> count = 0;
+
+    /**
+     *  @brief  Number of bytes allocated.
+     */
+    static inline std::atomic<std::size_t> bytes = 0;
+
+    /**
+     *  @brief   Get the number of allocations so far.
+     *  @return  Number of allocations.
+     */
+    [[nodiscard]] static inline auto current_count() -> std::size_t
+    {
+        if constexpr (alcelin::ac::instrumented)
+        {
+            return alcelin::ac::this_thread.allocations;
+        }
+        else return count;
+    }
+
+    /**
+     *  @brief   Get the number of bytes allocated so far.
+     *  @return  Number of bytes allocated.
+     */
+    [[nodiscard]] static inline auto current_bytes() -> std::size_t
+    {
+        if constexpr (alcelin::ac::instrumented)
+        {
+            return alcelin::ac::this_thread.bytes;
+        }
+        else return bytes;
+    }
+};
+
+/**
+ *  @brief  Named input size to run a benchmark with.
+ */
+struct input_size {
+
+    /**
+     *  @brief  Name of the size.
+     */
+    std::string_view name;
+
+    /**
+     *  @brief  Number of elements.
+     */
+    std::size_t size = 0;
+};
+
+/**
+ *  @brief  Small, medium and large input sizes.
+ */
+inline constexpr std::array<input_size, 3> sizes = {
+    input_size { "small", 16 },
+    input_size { "medium", 1024 },
+    input_size { "large", 65536 }
+};
+
+/**
+ *  @brief   Make deterministic numbers in range [0, 16).
+ *
+ *  @param   size  Number of elements.
+ *  @return  Numbers.
+ */
+[[nodiscard]] inline auto make_numbers(std::size_t size) -> std::vector<int>
+{
+    std::vector<int> numbers(size);
+    for (std::size_t i = 0; i < size; i++) numbers[i] = (i * 7 + 3) % 16;
+    return numbers;
+}
+
+/**
+ *  @brief   Make deterministic text of words separated by spaces and commas.
+ *
+ *  @param   size  Number of characters.
+ *  @return  Text.
+ */
+[[nodiscard]] inline auto make_text(std::size_t size) -> std::string
+{
+    constexpr std::string_view words =
+        "lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do "
+        "eiusmod tempor incididunt ut labore et dolore magna aliqua. ";
+
+    std::string text(size, ' ');
+    for (std::size_t i = 0; i < size; i++) text[i] = words[i % words.size()];
+    return text;
+}
+
+/**
+ *  @brief   Prevent the compiler from optimizing away a value.
+ *
+ *  @tparam  type   Type of value.
+ *  @param   value  Value to keep.
+ */
+template<typename type>
+inline auto do_not_optimize(const type &value) -> void
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile ("" : : "r,m"(value) : "memory");
+#else
+    static const void *volatile sink = nullptr;
+    sink = &value;
+    std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+/**
+ *  @brief  Options to run benchmarks with.
+ */
+struct options {
+
+    /**
+     *  @brief  Number of timed samples per benchmark.
+     */
+    std::size_t repetitions = 15;
+
+    /**
+     *  @brief  Minimum duration of one sample, the number of iterations per
+     *          sample is calibrated to reach it.
+     */
+    std::chrono::nanoseconds min_time = std::chrono::milliseconds(2);
+
+    /**
+     *  @brief  Duration to run a benchmark before taking samples.
+     */
+    std::chrono::nanoseconds warmup = std::chrono::milliseconds(20);
+
+    /**
+     *  @brief  Count hardware events with @c perf_counters , if available.
+     */
+    bool perf = false;
+
+    /**
+     *  @brief  Only run benchmarks whose "name/size" contains this.
+     */
+    std::string filter;
+};
+
+/**
+ *  @brief  Result of a benchmark.
+ */
+struct result {
+
+    /**
+     *  @brief  Name of the benchmark.
+     */
+    std::string name;
+
+    /**
+     *  @brief  Name of the input size.
+     */
+    std::string size;
+
+    /**
+     *  @brief  Number of iterations per sample.
+     */
+    std::size_t iterations = 0;
+
+    /**
+     *  @brief  Number of bytes processed per iteration.
+     */
+    std::size_t bytes = 0;
+
+    /**
+     *  @brief  Number of elements processed per iteration, the input size if
+     *          the size is named after one of @c sizes , one otherwise.
+     */
+    std::size_t elements = 1;
+
+    /**
+     *  @brief  Nanoseconds per iteration, for each sample.
+     */
+    std::vector<double> samples;
+
+    /**
+     *  @brief  Median of samples in nanoseconds per iteration.
+     */
+    double median = 0.0;
+
+    /**
+     *  @brief  99th percentile of samples in nanoseconds per iteration.
+     */
+    double p99 = 0.0;
+
+    /**
+     *  @brief  Mean of samples in nanoseconds per iteration.
+     */
+    double mean = 0.0;
+
+    /**
+     *  @brief  Minimum of samples in nanoseconds per iteration.
+     */
+    double min = 0.0;
+
+    /**
+     *  @brief  Allocations per iteration.
+     */
+    double allocations = 0.0;
+
+    /**
+     *  @brief  Bytes allocated per iteration.
+     */
+    double allocated_bytes = 0.0;
+
+    /**
+     *  @brief  Hardware events per iteration, if counted.
+     */
+    perf_values counters = {};
+
+    /**
+     *  @brief   Get the instructions per cycle.
+     *  @return  Instructions per cycle, if both were counted.
+     */
+    [[nodiscard]] inline auto ipc() const -> std::optional<double>
+    {
+        auto &cycles       = counters[(std::size_t)perf_event::cycles];
+        auto &instructions = counters[(std::size_t)perf_event::instructions];
+        if (!cycles || !instructions || *cycles <= 0.0) return std::nullopt;
+        return *instructions / *cycles;
+    }
+
+    /**
+     *  @brief   Get a hardware event per element.
+     *
+     *  @param   event  Hardware event.
+     *  @return  Event count per element, if counted.
+     */
+    [[nodiscard]] inline auto per_element(perf_event event) const
+    -> std::optional<double>
+    {
+        auto &counted = counters[(std::size_t)event];
+        if (!counted) return std::nullopt;
+        return *counted / elements;
+    }
+
+    /**
+     *  @brief   Get the throughput based on the median.
+     *  @return  Bytes processed per second.
+     */
+    [[nodiscard]] inline auto bytes_per_second() const -> double
+    {
+        if (median <= 0.0) return 0.0;
+        return (double)bytes * 1e9 / median;
+    }
+};
+
+/**
+ *  @brief   Get a percentile of sorted samples (nearest-rank).
+ *
+ *  @param   sorted      Sorted samples.
+ *  @param   percentile  Percentile in range [0, 1].
+ *  @return  Sample at percentile.
+ */
+[[nodiscard]] inline auto percentile(
+    const std::vector<double> &sorted,
+    double                     percentile
+) -> double
+{
+    if (sorted.empty()) return 0.0;
+
+    auto rank = (std::size_t)std::ceil(percentile * sorted.size());
+    return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+}
+
+/**
+ *  @brief   Escape a string for JSON.
+ *
+ *  @param   string  String to escape.
+ *  @return  Escaped string without the quotes.
+ */
+[[nodiscard]] inline auto json_escape(std::string_view string) -> std::string
+{
+    std::string escaped;
+    for (char character : string)
+    {
+        if (character == '"' || character == '\\') escaped += '\\';
+        escaped += character;
+    }
+    return escaped;
+}
+
+/**
+ *  @brief  Collection of benchmark results.
+ */
+struct suite {
+
+    /**
+     *  @brief  Options to run benchmarks with.
+     */
+    options opts;
+
+    /**
+     *  @brief  Results of the benchmarks run.
+     */
+    std::vector<result> results;
+
+    /**
+     *  @brief  Hardware performance counters, opened on first use if
+     *          @c options::perf is set and left null if unavailable.
+     */
+    std::unique_ptr<perf_counters> counters;
+
+    /**
+     *  @brief  Whether opening the hardware performance counters was tried.
+     */
+    bool counters_opened = false;
+
+    /**
+     *  @brief   Run a benchmark.
+     *
+     *  The operation is warmed up, calibrated so a sample takes at least
+     *  @c options::min_time , and then timed for @c options::repetitions
+     *  samples.  Non-void results of the operation are kept alive using
+     *  @c do_not_optimize .
+     *
+     *  @tparam  function   Type of operation.
+     *  @param   name       Name of the benchmark.
+     *  @param   size       Name of the input size.
+     *  @param   bytes      Bytes processed per operation, for throughput.
+     *  @param   operation  Operation to benchmark.
+     */
+    template<typename function>
+    inline auto run(
+        std::string_view name,
+        std::string_view size,
+        std::size_t      bytes,
+        function       &&operation
+    ) -> void
+    {
+        using clock = std::chrono::steady_clock;
+
+        if (!opts.filter.empty()
+         && std::format("{}/{}", name, size).find(opts.filter)
+         == std::string::npos) return;
+
+        auto batch = [&](std::size_t iterations) {
+            auto start = clock::now();
+            for (std::size_t i = 0; i < iterations; i++)
+            {
+                if constexpr (std::is_void_v<std::invoke_result_t<function &>>)
+                {
+                    operation();
+                }
+                else do_not_optimize(operation());
+            }
+            return clock::now() - start;
+        };
+
+        // Calibrate
+        std::size_t iterations = 1;
+        while (batch(iterations) < opts.min_time && iterations < (1uz << 30))
+        {
+            iterations *= 2;
+        }
+
+        // Warm-up
+        for (auto start = clock::now(); clock::now() - start < opts.warmup;)
+        {
+            batch(iterations);
+        }
+
+        result current = {};
+        current.name       = name;
+        current.size       = size;
+        current.iterations = iterations;
+        current.bytes      = bytes;
+
+        auto named = std::ranges::find(sizes, size, &input_size::name);
+        if (named != sizes.end()) current.elements = named->size;
+
+        auto perf = open_counters();
+        if (perf) perf->start();
+
+        std::size_t allocation_count = allocations::current_count();
+        std::size_t allocation_bytes = allocations::current_bytes();
+
+        for (std::size_t i = 0; i < opts.repetitions; i++)
+        {
+            std::chrono::duration<double, std::nano> elapsed =
+                batch(iterations);
+            current.samples.emplace_back(elapsed.count() / iterations);
+        }
+
+        double operations = (double)opts.repetitions * iterations;
+        if (perf)
+        {
+            auto counted = perf->stop();
+            for (std::size_t i = 0; i < perf_event_count; i++)
+            {
+                if (counted[i]) current.counters[i] = *counted[i] / operations;
+            }
+        }
+
+        current.allocations     =
+            (allocations::current_count() - allocation_count) / operations;
+        current.allocated_bytes =
+            (allocations::current_bytes() - allocation_bytes) / operations;
+
+        std::vector<double> sorted = current.samples;
+        std::ranges::sort(sorted);
+        current.median = percentile(sorted, 0.5);
+        current.p99    = percentile(sorted, 0.99);
+        current.min    = sorted.empty() ? 0.0 : sorted.front();
+        for (double sample : sorted) current.mean += sample;
+        if (!sorted.empty()) current.mean /= sorted.size();
+
+        std::print("{:<44} {:<16} {:>12.1f} ns/op {:>12.1f} p99 "
+                   "{:>9.2f} allocs/op {:>12.1f} MB/s",
+            current.name, current.size, current.median, current.p99,
+            current.allocations, current.bytes_per_second() / 1e6);
+
+        if (perf)
+        {
+            auto optional = [](std::optional<double> value) {
+                return value ? std::format("{:.3f}", *value) : "-";
+            };
+            std::print(" {:>6} IPC {:>8} br-miss/el {:>8} L1d-miss/el "
+                       "{:>8} LLC-miss/el", optional(current.ipc()),
+                optional(current.per_element(perf_event::branch_misses)),
+                optional(current.per_element(perf_event::l1d_misses)),
+                optional(current.per_element(perf_event::llc_misses)));
+        }
+        std::println();
+
+        results.emplace_back(std::move(current));
+    }
+
+    /**
+     *  @brief   Get the hardware performance counters, opening them on first
+     *           use.
+     *
+     *  @return  Counters, or null if not requested or unavailable.
+     */
+    inline auto open_counters() -> perf_counters *
+    {
+        if (!opts.perf) return nullptr;
+        if (!counters_opened)
+        {
+            counters_opened = true;
+            counters        = std::make_unique<perf_counters>();
+            if (!counters->available())
+            {
+                std::println(stderr, "Hardware performance counters are "
+                    "unavailable, continuing without them");
+                counters.reset();
+            }
+        }
+        return counters.get();
+    }
+
+    /**
+     *  @brief  Write results as JSON.
+     *
+     *  @param  output  Output stream to write to.
+     */
+    inline auto write_json(std::ostream &output) const -> void
+    {
+        output << "{\n";
+        output << std::format("  \"context\": {{\n"
+                              "    \"repetitions\": {},\n"
+                              "    \"min_time_ns\": {},\n"
+                              "    \"compiler\": \"{}\"\n"
+                              "  }},\n",
+            opts.repetitions, opts.min_time.count(), json_escape(compiler()));
+        output << "  \"benchmarks\": [\n";
+
+        for (std::size_t i = 0; i < results.size(); i++)
+        {
+            auto &current = results[i];
+
+            // Hardware events per iteration, null if not counted
+            std::string events;
+            for (std::size_t j = 0; j < perf_event_count; j++)
+            {
+                auto &counted = current.counters[j];
+                events += std::format("{}\"{}_per_op\": {}", j ? ", " : "",
+                    to_string((perf_event)j),
+                    counted ? std::format("{:.3f}", *counted) : "null");
+            }
+
+            std::string samples;
+            for (std::size_t j = 0; j < current.samples.size(); j++)
+            {
+                if (j) samples += ", ";
+                samples += std::format("{:.3f}", current.samples[j]);
+            }
+
+            output << std::format("    {{\n"
+                                  "      \"name\": \"{}\",\n"
+                                  "      \"size\": \"{}\",\n"
+                                  "      \"iterations\": {},\n"
+                                  "      \"median_ns\": {:.3f},\n"
+                                  "      \"p99_ns\": {:.3f},\n"
+                                  "      \"mean_ns\": {:.3f},\n"
+                                  "      \"min_ns\": {:.3f},\n"
+                                  "      \"bytes_per_second\": {:.3f},\n"
+                                  "      \"allocations_per_op\": {:.3f},\n"
+                                  "      \"allocated_bytes_per_op\": {:.3f},\n"
+                                  "      \"elements\": {},\n"
+                                  "      \"counters\": {{{}}},\n"
+                                  "      \"samples_ns\": [{}]\n"
+                                  "    }}{}\n",
+                json_escape(current.name), json_escape(current.size),
+                current.iterations, current.median, current.p99, current.mean,
+                current.min, current.bytes_per_second(), current.allocations,
+                current.allocated_bytes, current.elements, events, samples,
+                i + 1 < results.size() ? "," : "");
+        }
+
+        output << "  ]\n";
+        output << "}\n";
+    }
+
+    /**
+     *  @brief   Get the compiler used to build the benchmarks.
+     *  @return  Compiler name and version.
+     */
+    [[nodiscard]] static inline auto compiler() -> std::string
+    {
+#if defined(__clang__)
+        return std::format("Clang {}", __clang_version__);
+#elif defined(__GNUC__)
+        return std::format("GCC {}", __VERSION__);
+#elif defined(_MSC_VER)
+        return std::format("MSVC {}", _MSC_FULL_VER);
+#else
+        return "Unknown";
+#endif
+    }
+};
+
+} // namespace bench
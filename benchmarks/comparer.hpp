@@ -0,0 +1,588 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Statistical comparison of benchmark results.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+/**
+ *  @brief  Micro-benchmark harness for Alcelin.
+ */
+namespace bench {
+
+/**
+ *  @brief  Parsed JSON value.
+ */
+struct json_value {
+
+    /**
+     *  @brief  JSON array.
+     */
+    using array = std::vector<json_value>;
+
+    /**
+     *  @brief  JSON object, members in order of appearance.
+     */
+    using object = std::vector<std::pair<std::string, json_value>>;
+
+    /**
+     *  @brief  Value, null is @c std::monostate .
+     */
+    std::variant<std::monostate, bool, double, std::string, array, object>
+    value;
+
+    /**
+     *  @brief   Get a member of an object.
+     *
+     *  @param   name  Member name.
+     *  @return  Pointer to the member, or null if it is not an object or does
+     *           not have the member.
+     */
+    [[nodiscard]] inline auto member(std::string_view name) const
+    -> const json_value *
+    {
+        auto members = std::get_if<object>(&value);
+        if (!members) return nullptr;
+
+        auto it = std::ranges::find(*members, name, &object::value_type::first);
+        return it == members->end() ? nullptr : &it->second;
+    }
+};
+
+/**
+ *  @brief  Minimal JSON parser, enough to read back benchmark results.
+ */
+struct json_parser {
+
+    /**
+     *  @brief  Text to parse.
+     */
+    std::string_view text;
+
+    /**
+     *  @brief  Current position in text.
+     */
+    std::size_t position = 0;
+
+    /**
+     *  @brief   Parse the whole text as one value.
+     *  @return  Parsed value.
+     */
+    [[nodiscard]] inline auto parse() -> json_value
+    {
+        auto parsed = parse_value();
+        skip_whitespace();
+        if (position != text.size()) fail("Trailing characters");
+        return parsed;
+    }
+
+    /**
+     *  @brief  Throw with the current position.
+     *  @param  message  What went wrong.
+     */
+    [[noreturn]] inline auto fail(std::string_view message) const -> void
+    {
+        throw std::runtime_error(std::format("Invalid JSON at {}: {}",
+            position, message));
+    }
+
+    /**
+     *  @brief  Skip whitespace.
+     */
+    inline auto skip_whitespace() -> void
+    {
+        while (position < text.size()
+            && std::string_view(" \t\r\n").contains(text[position]))
+        {
+            position++;
+        }
+    }
+
+    /**
+     *  @brief   Consume a character if it is next.
+     *
+     *  @param   character  Character to consume.
+     *  @return  True if consumed.
+     */
+    inline auto consume(char character) -> bool
+    {
+        skip_whitespace();
+        if (position < text.size() && text[position] == character)
+        {
+            position++;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     *  @brief  Consume a character, failing if it is not next.
+     *  @param  character  Character to consume.
+     */
+    inline auto expect(char character) -> void
+    {
+        if (!consume(character))
+        {
+            fail(std::format("Expected '{}'", character));
+        }
+    }
+
+    /**
+     *  @brief   Parse any value.
+     *  @return  Parsed value.
+     */
+    inline auto parse_value() -> json_value
+    {
+        skip_whitespace();
+        if (position >= text.size()) fail("Unexpected end");
+
+        char next = text[position];
+        if (next == '{') return { parse_object() };
+        if (next == '[') return { parse_array() };
+        if (next == '"') return { parse_string() };
+        if (text.substr(position).starts_with("true"))
+        {
+            position += 4;
+            return { true };
+        }
+        if (text.substr(position).starts_with("false"))
+        {
+            position += 5;
+            return { false };
+        }
+        if (text.substr(position).starts_with("null"))
+        {
+            position += 4;
+            return {};
+        }
+        return { parse_number() };
+    }
+
+    /**
+     *  @brief   Parse an object.
+     *  @return  Parsed object.
+     */
+    inline auto parse_object() -> json_value::object
+    {
+        json_value::object members = {};
+        expect('{');
+        if (consume('}')) return members;
+
+        do
+        {
+            skip_whitespace();
+            auto name = parse_string();
+            expect(':');
+            members.emplace_back(std::move(name), parse_value());
+        }
+        while (consume(','));
+
+        expect('}');
+        return members;
+    }
+
+    /**
+     *  @brief   Parse an array.
+     *  @return  Parsed array.
+     */
+    inline auto parse_array() -> json_value::array
+    {
+        json_value::array elements = {};
+        expect('[');
+        if (consume(']')) return elements;
+
+        do
+        {
+            elements.emplace_back(parse_value());
+        }
+        while (consume(','));
+
+        expect(']');
+        return elements;
+    }
+
+    /**
+     *  @brief   Parse a string.  Unicode escapes are kept as is.
+     *  @return  Parsed string.
+     */
+    inline auto parse_string() -> std::string
+    {
+        std::string string = {};
+        expect('"');
+
+        while (position < text.size() && text[position] != '"')
+        {
+            char character = text[position++];
+            if (character == '\\' && position < text.size())
+            {
+                char escaped = text[position++];
+                switch (escaped)
+                {
+                case 'n': character = '\n'; break;
+                case 't': character = '\t'; break;
+                case 'r': character = '\r'; break;
+                case 'b': character = '\b'; break;
+                case 'f': character = '\f'; break;
+                case 'u': string += "\\"; character = 'u'; break;
+                default: character = escaped; break;
+                }
+            }
+            string += character;
+        }
+
+        if (position >= text.size()) fail("Unterminated string");
+        position++;
+        return string;
+    }
+
+    /**
+     *  @brief   Parse a number.
+     *  @return  Parsed number.
+     */
+    inline auto parse_number() -> double
+    {
+        double number = 0.0;
+        auto   first  = text.data() + position;
+        auto [end, error] = std::from_chars(first, text.data() + text.size(),
+            number);
+        if (error != std::errc()) fail("Expected a value");
+        position += end - first;
+        return number;
+    }
+};
+
+/**
+ *  @brief  Samples of a benchmark read back from JSON results.
+ */
+struct recorded {
+
+    /**
+     *  @brief  Name of the benchmark.
+     */
+    std::string name;
+
+    /**
+     *  @brief  Name of the input size.
+     */
+    std::string size;
+
+    /**
+     *  @brief  Median in nanoseconds per iteration.
+     */
+    double median = 0.0;
+
+    /**
+     *  @brief  Samples in nanoseconds per iteration.
+     */
+    std::vector<double> samples;
+};
+
+/**
+ *  @brief   Read benchmark results written by @c suite::write_json .
+ *
+ *  @param   filename  JSON file.
+ *  @return  Recorded benchmarks.
+ */
+[[nodiscard]] inline auto read_results(std::string_view filename)
+-> std::vector<recorded>
+{
+    std::ifstream input((std::string(filename)));
+    if (!input)
+    {
+        throw std::runtime_error(std::format("Failed to open file {}",
+            filename));
+    }
+
+    auto text       = std::string(std::istreambuf_iterator(input), {});
+    auto root       = json_parser { text }.parse();
+    auto benchmarks = root.member("benchmarks");
+    if (!benchmarks || !std::holds_alternative<json_value::array>(
+        benchmarks->value))
+    {
+        throw std::runtime_error(std::format("No benchmarks in {}",
+            filename));
+    }
+
+    auto string = [](const json_value *value) {
+        auto string = value ? std::get_if<std::string>(&value->value)
+                            : nullptr;
+        return string ? *string : std::string();
+    };
+    auto number = [](const json_value *value) {
+        auto number = value ? std::get_if<double>(&value->value) : nullptr;
+        return number ? *number : 0.0;
+    };
+
+    std::vector<recorded> results = {};
+    for (auto &benchmark : std::get<json_value::array>(benchmarks->value))
+    {
+        recorded current = {};
+        current.name   = string(benchmark.member("name"));
+        current.size   = string(benchmark.member("size"));
+        current.median = number(benchmark.member("median_ns"));
+
+        auto samples = benchmark.member("samples_ns");
+        auto array   = samples ? std::get_if<json_value::array>(
+            &samples->value) : nullptr;
+        if (array)
+        {
+            for (auto &sample : *array)
+            {
+                current.samples.emplace_back(number(&sample));
+            }
+        }
+
+        results.emplace_back(std::move(current));
+    }
+    return results;
+}
+
+/**
+ *  @brief   Two-sided Mann-Whitney U test of two independent samples.
+ *
+ *  Uses the normal approximation with tie and continuity correction, which is
+ *  reasonable from around 8 samples each.
+ *
+ *  @param   a  First samples.
+ *  @param   b  Second samples.
+ *  @return  Probability of seeing the difference if both samples come from
+ *           the same distribution.  One if either is empty.
+ */
+[[nodiscard]] inline auto mann_whitney(
+    const std::vector<double> &a,
+    const std::vector<double> &b
+) -> double
+{
+    if (a.empty() || b.empty()) return 1.0;
+
+    // Rank the pooled samples, ties get the average of their ranks
+    std::vector<std::pair<double, bool>> pooled = {};
+    for (double sample : a) pooled.emplace_back(sample, true);
+    for (double sample : b) pooled.emplace_back(sample, false);
+    std::ranges::sort(pooled);
+
+    double rank_sum_a = 0.0;
+    double ties       = 0.0;
+    for (std::size_t i = 0; i < pooled.size();)
+    {
+        std::size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) j++;
+
+        double tied = j - i;
+        double rank = (i + 1 + j) / 2.0;
+        for (std::size_t k = i; k < j; k++)
+        {
+            if (pooled[k].second) rank_sum_a += rank;
+        }
+        ties += tied * tied * tied - tied;
+        i     = j;
+    }
+
+    double n_a  = a.size();
+    double n_b  = b.size();
+    double n    = n_a + n_b;
+    double u    = rank_sum_a - n_a * (n_a + 1) / 2.0;
+    double mean = n_a * n_b / 2.0;
+    double variance = n_a * n_b / 12.0 * ((n + 1) - ties / (n * (n - 1)));
+    if (variance <= 0.0) return 1.0;
+
+    double z = std::max(std::abs(u - mean) - 0.5, 0.0) / std::sqrt(variance);
+    return std::erfc(z / std::sqrt(2.0));
+}
+
+/**
+ *  @brief  Verdict of a benchmark comparison.
+ */
+enum class verdict {
+    unknown = -1,
+    unchanged, // Median did not change significantly
+    improved,  // Median got significantly faster
+    regressed, // Median got significantly slower
+    missing,   // Benchmark is only in the baseline
+    max
+};
+
+/**
+ *  @brief   Convert verdict to string.
+ *
+ *  @param   result  Verdict.
+ *  @return  String representation of verdict.
+ */
+[[nodiscard]] inline constexpr auto to_string(verdict result)
+{
+    using namespace std::string_literals;
+    switch (result)
+    {
+        case verdict::unknown: return "unknown"s;
+        case verdict::unchanged: return "unchanged"s;
+        case verdict::improved: return "improved"s;
+        case verdict::regressed: return "regressed"s;
+        case verdict::missing: return "missing"s;
+        case verdict::max: return "max"s;
+    }
+    return ""s;
+}
+
+/**
+ *  @brief  Comparison of a benchmark between two runs.
+ */
+struct comparison {
+
+    /**
+     *  @brief  Name of the benchmark.
+     */
+    std::string name;
+
+    /**
+     *  @brief  Name of the input size.
+     */
+    std::string size;
+
+    /**
+     *  @brief  Baseline median in nanoseconds per iteration.
+     */
+    double baseline = 0.0;
+
+    /**
+     *  @brief  Current median in nanoseconds per iteration.
+     */
+    double current = 0.0;
+
+    /**
+     *  @brief  Relative change of the median, positive is slower.
+     */
+    double change = 0.0;
+
+    /**
+     *  @brief  Mann-Whitney p-value of the samples.
+     */
+    double p_value = 1.0;
+
+    /**
+     *  @brief  Verdict.
+     */
+    verdict result = verdict::unknown;
+};
+
+/**
+ *  @brief   Compare the benchmarks present in both runs.
+ *
+ *  A benchmark regressed or improved if its median changed by more than the
+ *  threshold and the change is significant.  Benchmarks only in the baseline
+ *  are missing, with only their baseline median.
+ *
+ *  @param   baseline   Baseline run.
+ *  @param   current    Current run.
+ *  @param   threshold  Relative change of median to ignore, 0.05 is 5%.
+ *  @param   alpha      Significance level.
+ *  @return  Comparisons in order of the current run, followed by the missing
+ *           benchmarks in order of the baseline.
+ */
+[[nodiscard]] inline auto compare(
+    const std::vector<recorded> &baseline,
+    const std::vector<recorded> &current,
+    double                       threshold,
+    double                       alpha
+) -> std::vector<comparison>
+{
+    std::vector<comparison> comparisons = {};
+    for (auto &now : current)
+    {
+        auto before = std::ranges::find_if(baseline, [&](auto &recorded) {
+            return recorded.name == now.name && recorded.size == now.size;
+        });
+        if (before == baseline.end()) continue;
+
+        comparison compared = {};
+        compared.name     = now.name;
+        compared.size     = now.size;
+        compared.baseline = before->median;
+        compared.current  = now.median;
+        compared.p_value  = mann_whitney(before->samples, now.samples);
+        if (before->median > 0.0)
+        {
+            compared.change = now.median / before->median - 1.0;
+        }
+
+        compared.result = verdict::unchanged;
+        if (compared.p_value < alpha)
+        {
+            if (compared.change > threshold)
+            {
+                compared.result = verdict::regressed;
+            }
+            else if (compared.change < -threshold)
+            {
+                compared.result = verdict::improved;
+            }
+        }
+        comparisons.emplace_back(std::move(compared));
+    }
+
+    for (auto &before : baseline)
+    {
+        auto now = std::ranges::find_if(current, [&](auto &recorded) {
+            return recorded.name == before.name
+                && recorded.size == before.size;
+        });
+        if (now != current.end()) continue;
+
+        comparison missing = {};
+        missing.name     = before.name;
+        missing.size     = before.size;
+        missing.baseline = before.median;
+        missing.result   = verdict::missing;
+        comparisons.emplace_back(std::move(missing));
+    }
+    return comparisons;
+}
+
+} // namespace bench
@@ -0,0 +1,77 @@
+# Compile-time benchmark: builds the tests against the headers and against the
+# alcelin module, and compares the time to compile the tests
+#
+# Usage: cmake [-DREPETITIONS=3] [-DGENERATOR=Ninja] [-DBINARY_DIR=dir]
+#              -P benchmarks/compile_time.cmake
+
+cmake_minimum_required(VERSION 3.30)
+
+get_filename_component(SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+
+if(NOT DEFINED REPETITIONS)
+    set(REPETITIONS 3)
+endif()
+if(NOT DEFINED GENERATOR)
+    set(GENERATOR Ninja)
+endif()
+if(NOT DEFINED BINARY_DIR)
+    set(BINARY_DIR "${SOURCE_DIR}/build/compile_time")
+endif()
+
+# Run a command, failing the benchmark if it fails
+function(compile_time_run)
+    execute_process(COMMAND ${ARGN} RESULT_VARIABLE result OUTPUT_QUIET)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Command failed: ${ARGN}")
+    endif()
+endfunction()
+
+# Get the current time in milliseconds
+function(compile_time_now OUTPUT)
+    string(TIMESTAMP microseconds "%s%f")
+    math(EXPR milliseconds "${microseconds} / 1000")
+    set(${OUTPUT} ${milliseconds} PARENT_SCOPE)
+endfunction()
+
+# Time the tests' build, the library and module are built beforehand so only
+# the tests' translation units are measured
+function(compile_time_measure VARIANT OUTPUT)
+    set(build_dir "${BINARY_DIR}/${VARIANT}")
+    compile_time_run("${CMAKE_COMMAND}" -S "${SOURCE_DIR}" -B "${build_dir}"
+        -G "${GENERATOR}" -DCMAKE_BUILD_TYPE=Debug -DALCELIN_BUILD_TESTS=ON
+        ${ARGN})
+
+    set(samples)
+    foreach(i RANGE 1 ${REPETITIONS})
+        compile_time_run("${CMAKE_COMMAND}" --build "${build_dir}"
+            --target clean)
+        compile_time_run("${CMAKE_COMMAND}" --build "${build_dir}"
+            --target alcelin)
+        if(VARIANT STREQUAL "module")
+            compile_time_run("${CMAKE_COMMAND}" --build "${build_dir}"
+                --target alcelin_module)
+        endif()
+
+        compile_time_now(start)
+        compile_time_run("${CMAKE_COMMAND}" --build "${build_dir}"
+            --target alcelin_tester)
+        compile_time_now(end)
+
+        math(EXPR elapsed "${end} - ${start}")
+        list(APPEND samples ${elapsed})
+        message("${VARIANT} #${i}: ${elapsed} ms")
+    endforeach()
+
+    list(SORT samples COMPARE NATURAL)
+    math(EXPR middle "${REPETITIONS} / 2")
+    list(GET samples ${middle} median)
+    set(${OUTPUT} ${median} PARENT_SCOPE)
+endfunction()
+
+compile_time_measure(headers headers_ms)
+compile_time_measure(module module_ms
+    -DALCELIN_BUILD_MODULE=ON -DALCELIN_TESTS_USE_MODULE=ON)
+
+math(EXPR saved "${headers_ms} - ${module_ms}")
+message("Tests compile time (median of ${REPETITIONS}): "
+    "headers ${headers_ms} ms, module ${module_ms} ms, saved ${saved} ms")
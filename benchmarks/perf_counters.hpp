@@ -0,0 +1,240 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Hardware performance counters for the benchmarks.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <utility>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+/**
+ *  @brief  Micro-benchmark harness for Alcelin.
+ */
+namespace bench {
+
+/**
+ *  @brief  Hardware events counted by @c perf_counters .
+ */
+enum class perf_event {
+    unknown = -1,
+    cycles,
+    instructions,
+    branch_misses,
+    l1d_misses,
+    llc_misses,
+    max
+};
+
+/**
+ *  @brief  Number of hardware events.
+ */
+inline constexpr auto perf_event_count = (std::size_t)perf_event::max;
+
+/**
+ *  @brief   Convert hardware event to string.
+ *
+ *  @param   event  Hardware event.
+ *  @return  String representation of hardware event, as used in the JSON
+ *           output.
+ */
+[[nodiscard]] inline constexpr auto to_string(perf_event event)
+{
+    using namespace std::string_literals;
+    switch (event)
+    {
+        case perf_event::unknown: return "unknown"s;
+        case perf_event::cycles: return "cycles"s;
+        case perf_event::instructions: return "instructions"s;
+        case perf_event::branch_misses: return "branch_misses"s;
+        case perf_event::l1d_misses: return "l1d_misses"s;
+        case perf_event::llc_misses: return "llc_misses"s;
+        case perf_event::max: return "max"s;
+    }
+    return ""s;
+}
+
+/**
+ *  @brief  Value of each hardware event, if it could be counted.
+ */
+using perf_values = std::array<std::optional<double>, perf_event_count>;
+
+/**
+ *  @brief  Hardware performance counters of the calling thread, using
+ *          Linux's @c perf_event_open .
+ *
+ *  Each event is opened on its own, so the events the CPU or kernel does not
+ *  support (or @c perf_event_paranoid does not allow) are left out instead of
+ *  failing the others.  When the kernel multiplexes the counters, the values
+ *  are scaled by the time the counter was running.  On other systems nothing
+ *  is available.
+ */
+struct perf_counters {
+
+    /**
+     *  @brief  File descriptor of each event, -1 if not available.
+     */
+    std::array<int, perf_event_count> descriptors = { -1, -1, -1, -1, -1 };
+
+    /**
+     *  @brief  Open the counters, disabled.
+     */
+    inline perf_counters()
+    {
+#if defined(__linux__)
+        auto cache = [](std::uint64_t cache) {
+            return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                         | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        };
+
+        std::array<std::pair<std::uint32_t, std::uint64_t>, perf_event_count>
+        events = {
+            std::pair { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES },
+            std::pair { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+            std::pair { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+            std::pair { PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_L1D) },
+            std::pair { PERF_TYPE_HW_CACHE, cache(PERF_COUNT_HW_CACHE_LL) }
+        };
+
+        for (std::size_t i = 0; i < perf_event_count; i++)
+        {
+            perf_event_attr attributes = {};
+            attributes.size           = sizeof (attributes);
+            attributes.type           = events[i].first;
+            attributes.config         = events[i].second;
+            attributes.disabled       = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv     = 1;
+            attributes.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED
+                                      | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            descriptors[i] = (int)syscall(SYS_perf_event_open, &attributes, 0,
+                -1, -1, 0);
+        }
+#endif
+    }
+
+    perf_counters(const perf_counters &) = delete;
+    auto operator= (const perf_counters &) -> perf_counters & = delete;
+
+    /**
+     *  @brief  Close the counters.
+     */
+    inline ~perf_counters()
+    {
+#if defined(__linux__)
+        for (int descriptor : descriptors)
+        {
+            if (descriptor != -1) close(descriptor);
+        }
+#endif
+    }
+
+    /**
+     *  @brief   Check whether any event can be counted.
+     *  @return  True if at least one event is available.
+     */
+    [[nodiscard]] inline auto available() const -> bool
+    {
+        for (int descriptor : descriptors)
+        {
+            if (descriptor != -1) return true;
+        }
+        return false;
+    }
+
+    /**
+     *  @brief  Reset and start counting.
+     */
+    inline auto start() -> void
+    {
+#if defined(__linux__)
+        for (int descriptor : descriptors)
+        {
+            if (descriptor == -1) continue;
+            ioctl(descriptor, PERF_EVENT_IOC_RESET, 0);
+            ioctl(descriptor, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /**
+     *  @brief   Stop counting and read the counted values.
+     *  @return  Value of each event since @c start , if counted.
+     */
+    inline auto stop() -> perf_values
+    {
+        perf_values values = {};
+
+#if defined(__linux__)
+        for (int descriptor : descriptors)
+        {
+            if (descriptor != -1)
+            {
+                ioctl(descriptor, PERF_EVENT_IOC_DISABLE, 0);
+            }
+        }
+
+        for (std::size_t i = 0; i < perf_event_count; i++)
+        {
+            if (descriptors[i] == -1) continue;
+
+            // Value, time enabled and time running
+            std::uint64_t data[3] = {};
+            if (read(descriptors[i], data, sizeof (data)) != sizeof (data)
+             || data[2] == 0) continue;
+
+            values[i] = (double)data[0] * ((double)data[1] / data[2]);
+        }
+#endif
+
+        return values;
+    }
+};
+
+} // namespace bench
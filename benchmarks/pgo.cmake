@@ -0,0 +1,74 @@
+# Profile-guided optimization: builds the library, examples and benchmarks at
+# -O2, and again with link-time and profile-guided optimization trained by
+# alcelin_train, then compares the benchmarks of both builds
+#
+# Usage: cmake [-DITERATIONS=20] [-DGENERATOR=Ninja] [-DBINARY_DIR=dir]
+#              [-DBENCH_ARGS=--filter;sm::] -P benchmarks/pgo.cmake
+
+cmake_minimum_required(VERSION 3.30)
+
+get_filename_component(SOURCE_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+
+if(NOT DEFINED ITERATIONS)
+    set(ITERATIONS 20)
+endif()
+if(NOT DEFINED BINARY_DIR)
+    set(BINARY_DIR "${SOURCE_DIR}/build/pgo")
+endif()
+if(DEFINED GENERATOR)
+    set(generator_args -G "${GENERATOR}")
+endif()
+
+# Run a command in a directory, failing the build if it fails
+function(pgo_run directory)
+    execute_process(COMMAND ${ARGN} WORKING_DIRECTORY "${directory}"
+        RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Command failed: ${ARGN}")
+    endif()
+endfunction()
+
+# Configure a build, the same options except for the optimizations
+function(pgo_configure build_dir)
+    file(MAKE_DIRECTORY "${build_dir}")
+    pgo_run("${build_dir}" "${CMAKE_COMMAND}" -S "${SOURCE_DIR}"
+        -B "${build_dir}" ${generator_args} -DCMAKE_BUILD_TYPE=Release
+        "-DCMAKE_CXX_FLAGS_RELEASE=-O2 -DNDEBUG"
+        -DALCELIN_BUILD_EXAMPLES=ON -DALCELIN_BUILD_BENCHMARKS=ON ${ARGN})
+endfunction()
+
+set(plain_dir "${BINARY_DIR}/plain")
+set(pgo_dir "${BINARY_DIR}/pgo")
+set(profile_dir "${pgo_dir}/profile")
+
+message("Building at -O2")
+pgo_configure("${plain_dir}")
+pgo_run("${plain_dir}" "${CMAKE_COMMAND}" --build "${plain_dir}")
+
+message("Training the instrumented build")
+file(REMOVE_RECURSE "${profile_dir}")
+pgo_configure("${pgo_dir}" -DALCELIN_LTO=ON -DALCELIN_PGO_GENERATE=ON
+    -DALCELIN_PGO_USE=OFF "-DALCELIN_PGO_DIR=${profile_dir}")
+pgo_run("${pgo_dir}" "${CMAKE_COMMAND}" --build "${pgo_dir}"
+    --target alcelin_train)
+pgo_run("${pgo_dir}" "${pgo_dir}/benchmarks/alcelin_train" ${ITERATIONS})
+
+message("Building with the profile and link-time optimization")
+pgo_configure("${pgo_dir}" -DALCELIN_PGO_GENERATE=OFF -DALCELIN_PGO_USE=ON)
+pgo_run("${pgo_dir}" "${CMAKE_COMMAND}" --build "${pgo_dir}")
+
+message("Benchmarking both builds")
+pgo_run("${plain_dir}" "${plain_dir}/benchmarks/alcelin_bench"
+    --json "${BINARY_DIR}/plain.json" ${BENCH_ARGS})
+pgo_run("${pgo_dir}" "${pgo_dir}/benchmarks/alcelin_bench"
+    --json "${BINARY_DIR}/pgo.json" ${BENCH_ARGS})
+
+# Exits with 1 if anything is slower, which is a result and not a failure
+execute_process(
+    COMMAND "${plain_dir}/benchmarks/alcelin_bench_compare"
+        "${BINARY_DIR}/plain.json" "${BINARY_DIR}/pgo.json"
+    RESULT_VARIABLE result
+)
+if(result GREATER 1)
+    message(FATAL_ERROR "Could not compare the benchmarks")
+endif()
@@ -0,0 +1,303 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Training workload for profile-guided optimization.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdio>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <ios>
+#include <numeric>
+#include <print>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "alcelin.hpp"
+
+using namespace alcelin;
+using namespace aec_operators;
+
+/**
+ *  @brief  Record written to and read from chunk files.
+ */
+struct train_record {
+
+    /**
+     *  @brief  Line number in the log.
+     */
+    std::size_t line = 0;
+
+    /**
+     *  @brief  Level of the line, index in @c train_levels .
+     */
+    int level = 0;
+
+    /**
+     *  @brief  Request duration in milliseconds.
+     */
+    int duration = 0;
+};
+
+/**
+ *  @brief  Log levels with their colors.
+ */
+inline const std::vector<std::pair<std::string_view, aec::aec_t>>
+train_levels = {
+    { "DEBUG", aec::gray },
+    { "INFO", aec::green },
+    { "WARN", aec::yellow },
+    { "ERROR", aec::bold + aec::red }
+};
+
+/**
+ *  @brief   Make a server log.
+ *
+ *  @param   lines  Number of lines.
+ *  @return  Log with a line per request.
+ */
+auto make_log(std::size_t lines) -> std::string
+{
+    std::string log;
+    for (std::size_t i = 0; i < lines; i++)
+    {
+        // Mostly informational, like real logs
+        std::size_t level = i % 16 == 0 ? 3 : i % 7 == 0 ? 2 : i % 3 == 0;
+        log += std::format("2024-06-{:02} 12:{:02}:{:02} [{}] worker-{} "
+            "handled GET /api/items/{} in {} ms\n", 1 + i % 28, i / 60 % 60,
+            i % 60, train_levels[level].first, i % 8, i * 37 % 1000,
+            i * 13 % 250);
+    }
+    return log;
+}
+
+/**
+ *  @brief   Split the log into lines and fields, and summarize it.
+ *
+ *  @param   log      Log made by @c make_log .
+ *  @param   records  Records parsed from the log.
+ *  @return  Summary of the log.
+ */
+auto train_logs(
+    std::string_view           log,
+    std::vector<train_record> &records
+) -> std::string
+{
+    std::vector<int> durations;
+    std::size_t      number = 0;
+
+    for (auto &line : sm::split(log, '\n'))
+    {
+        if (sm::trim(line).empty()) continue;
+
+        auto fields = sm::split(line, ' ');
+        if (fields.size() < 10) continue;
+
+        auto level = sm::filter_out_occ(fields[2], "[]");
+        int  index = 0;
+        while (index < (int)train_levels.size() - 1
+            && !sm::is_equal_ins(train_levels[index].first, level))
+        {
+            index++;
+        }
+
+        int duration = 0;
+        std::from_chars(fields[8].data(), fields[8].data() + fields[8].size(),
+            duration);
+
+        durations.emplace_back(duration);
+        records.emplace_back(number++, index, duration);
+    }
+
+    // Requests under 100 ms are fast, and separate the runs of slow requests
+    std::vector<int> fast(100);
+    std::iota(fast.begin(), fast.end(), 0);
+
+    auto runs = cu::split_occ(durations, fast);
+    auto slow = cu::filter_out_occ(durations, fast);
+    std::erase_if(runs, [](const auto &run) { return run.empty(); });
+    auto messages = sm::split_occ_seq(log, std::vector<std::string> {
+        "[ERROR] ", "[WARN] "
+    });
+
+    return std::format("{} lines, {} slow in {} runs, {} messages\n{}\n",
+        number, slow.size(), runs.size(), messages.size(),
+        sm::word_wrap(sm::to_string(cu::slice(durations, 0, 64, true)), 40));
+}
+
+/**
+ *  @brief   Color the log lines by their level.
+ *
+ *  @param   log      Log made by @c make_log .
+ *  @param   records  Records parsed from the log.
+ *  @return  Colored log.
+ */
+auto train_colors(
+    std::string_view                 log,
+    const std::vector<train_record> &records
+) -> std::string
+{
+    std::ostringstream stream;
+    auto               lines = sm::split(log, '\n');
+
+    for (auto &record : records)
+    {
+        auto &[name, color] = train_levels[record.level];
+        stream << color << sm::to_upper(name) << ~color << ' '
+               << lines[record.line] << '\n';
+
+        unsigned char shade = 232 + record.duration % 24;
+        stream << std::format("{}{:>5} ms{}\n", aec::color(shade),
+            record.duration, aec::reset);
+    }
+
+    stream << aec::cup(1, 1) << aec::color(255, 128, 0)("done") << '\n';
+    return stream.str();
+}
+
+/**
+ *  @brief   Write the records to a chunk file and read them back.
+ *
+ *  @param   filename  File to write to.
+ *  @param   log       Log made by @c make_log .
+ *  @param   records   Records to write.
+ *  @return  Checksum of the data read back.
+ */
+auto train_chunks(
+    std::string_view                 filename,
+    std::string_view                 log,
+    const std::vector<train_record> &records
+) -> long long
+{
+    {
+        std::ofstream output((std::string(filename)), std::ios::binary);
+        file::write_chunk(output, file::to_sd_chunk(records.size()));
+        for (auto &record : records) file::write_data(output, record);
+        file::write_chunk(output, file::sd_chunk(log.begin(), log.end()));
+    }
+
+    long long     sum = 0;
+    std::ifstream input((std::string(filename)), std::ios::binary);
+    auto          count = file::read_data<std::size_t>(input);
+    for (std::size_t i = 0; i < count; i++)
+    {
+        sum += file::read_data<train_record>(input).duration;
+    }
+    sum += file::read_chunk(input).size();
+    input.close();
+
+    sum += file::read_all(filename).size();
+    std::remove(filename.data());
+    return sum;
+}
+
+/**
+ *  @brief   Update properties as an application's model would.
+ *
+ *  @param   records  Records to apply.
+ *  @return  Final value of the model.
+ */
+auto train_properties(const std::vector<train_record> &records) -> long long
+{
+    int  value    = 0;
+    auto property = prop::property<int>(
+        [&]() { return value; },
+        [&](const int &v) { value = v; });
+
+    prop::observable<int>         requests = 0;
+    prop::observable<int>         total    = 0;
+    prop::observable<std::string> status   = std::string("idle");
+    prop::computed                average([&]() {
+        return requests.get() == 0 ? 0 : total.get() / requests.get();
+    });
+
+    prop::observable_vector<int> slow;
+    long long                    changes = 0;
+    requests.changed.connect([&](const int &) { changes++; });
+    slow.changed.connect([&](const prop::vector_change &change) {
+        changes += change.count;
+    });
+
+    for (auto &record : records)
+    {
+        prop::batch batch;
+        requests += 1;
+        total    += record.duration;
+        property += record.duration;
+        if (record.duration > 200) slow.push_back(record.duration);
+        if (record.level == 3) status = std::format("error at {}", record.line);
+        if (slow.size() > 100) slow.clear();
+    }
+
+    return value + average.get() + changes + (long long)status.get().size();
+}
+
+/**
+ *  @brief   Run representative workloads to train profile-guided
+ *           optimization.
+ *
+ *  Usage: alcelin_train [iterations]
+ *
+ *  @param   argc  Argument count.
+ *  @param   argv  Argument values.
+ *  @return  Exit code.
+ */
+auto main(int argc, char **argv) -> int
+{
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 20;
+
+    long long checksum = 0;
+    for (int i = 0; i < iterations; i++)
+    {
+        std::string               log = make_log(2000 + 100 * i);
+        std::vector<train_record> records;
+
+        checksum += train_logs(log, records).size();
+        checksum += train_colors(log, records).size();
+        checksum += train_chunks("alcelin_train.bin", log, records);
+        checksum += train_properties(records);
+    }
+
+    std::println("Trained {} iterations, checksum {}", iterations, checksum);
+    return 0;
+}
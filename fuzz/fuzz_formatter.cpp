@@ -0,0 +1,79 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Fuzz target for the container formatter.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "alcelin_string_manipulators.hpp"
+#include "fuzzer.hpp"
+
+/**
+ *  @brief   Fuzz the container @c std::formatter::parse .
+ *
+ *  The input is the format specifier, formatting a container of numbers and
+ *  a container of strings.
+ *
+ *  @param   data  Input data.
+ *  @param   size  Input size in bytes.
+ *  @return  0, or -1 if the input is rejected.
+ */
+extern "C" auto LLVMFuzzerTestOneInput(
+    const std::uint8_t *data,
+    std::size_t         size
+) -> int
+{
+    return fuzz::run(data, size, [](std::string_view input) {
+        std::vector<int>         numbers = { 1, 22, 333 };
+        std::vector<std::string> strings = { "a", "bc" };
+        std::string              format  = "{:" + std::string(input) + "}";
+
+        // Invalid specifiers are expected to throw
+        try
+        {
+            auto result = std::vformat(format,
+                std::make_format_args(numbers));
+            result += std::vformat(format, std::make_format_args(strings));
+        }
+        catch (const std::format_error &) {}
+    });
+}
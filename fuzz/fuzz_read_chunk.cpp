@@ -0,0 +1,90 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Fuzz target for the chunk reading functions.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+
+#include "alcelin_file_utilities.hpp"
+#include "fuzzer.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief   Fuzz @c file::read_chunk and @c file::read_data .
+ *
+ *  The input is a stream of chunks, each a 64-bit length followed by as many
+ *  bytes, as written by @c file::write_chunk .
+ *
+ *  @param   data  Input data.
+ *  @param   size  Input size in bytes.
+ *  @return  0, or -1 if the input is rejected.
+ */
+extern "C" auto LLVMFuzzerTestOneInput(
+    const std::uint8_t *data,
+    std::size_t         size
+) -> int
+{
+    return fuzz::run(data, size, [](std::string_view input) {
+        std::istringstream stream((std::string(input)));
+
+        while (stream.peek() != std::istringstream::traits_type::eof())
+        {
+            auto chunk = file::read_chunk(stream);
+            if (!stream) break;
+
+            // A chunk is never larger than the stream it was read from
+            if (chunk.size() > input.size())
+            {
+                fuzz::fail("read_chunk read past the stream", input);
+            }
+        }
+
+        // Chunks of another size than the type are expected to throw
+        std::istringstream data_stream((std::string(input)));
+        try
+        {
+            static_cast<void>(file::read_data<long long>(data_stream));
+        }
+        catch (const std::invalid_argument &) {}
+    });
+}
@@ -0,0 +1,90 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Fuzz target for the split_occ_seq functions.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "alcelin_container_utilities.hpp"
+#include "alcelin_string_manipulators.hpp"
+#include "fuzzer.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief   Fuzz @c cu::split_occ_seq and @c sm::split_occ_seq .
+ *
+ *  The first line of the input holds the patterns separated by '|', the rest
+ *  is the text to split.
+ *
+ *  @param   data  Input data.
+ *  @param   size  Input size in bytes.
+ *  @return  0, or -1 if the input is rejected.
+ */
+extern "C" auto LLVMFuzzerTestOneInput(
+    const std::uint8_t *data,
+    std::size_t         size
+) -> int
+{
+    return fuzz::run(data, size, [](std::string_view input) {
+        auto newline = input.find('\n');
+        if (newline == std::string_view::npos) return;
+
+        auto patterns = sm::split(input.substr(0, newline), '|');
+        auto text     = input.substr(newline + 1);
+
+        std::vector<char> text_vec(text.begin(), text.end());
+        std::vector<std::vector<char>> patterns_vec;
+        for (auto &pattern : patterns)
+        {
+            patterns_vec.emplace_back(pattern.begin(), pattern.end());
+        }
+
+        auto split  = cu::split_occ_seq(text_vec, patterns_vec);
+        auto joined = sm::split_occ_seq(text, patterns);
+
+        // Both split the same, and never into more parts than characters
+        if (split.size() != joined.size() || split.size() > text.size() + 1)
+        {
+            fuzz::fail("split_occ_seq mismatch", input);
+        }
+    });
+}
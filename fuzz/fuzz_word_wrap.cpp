@@ -0,0 +1,91 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Fuzz target for word_wrap.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+#include "alcelin_string_manipulators.hpp"
+#include "fuzzer.hpp"
+
+using namespace alcelin;
+
+/**
+ *  @brief   Fuzz @c sm::word_wrap .
+ *
+ *  The first byte of the input is the width, the lowest bit of the second
+ *  byte forces splitting words, and the rest is the text to wrap.
+ *
+ *  @param   data  Input data.
+ *  @param   size  Input size in bytes.
+ *  @return  0, or -1 if the input is rejected.
+ */
+extern "C" auto LLVMFuzzerTestOneInput(
+    const std::uint8_t *data,
+    std::size_t         size
+) -> int
+{
+    return fuzz::run(data, size, [](std::string_view input) {
+        if (input.size() < 2) return;
+
+        std::size_t width = (unsigned char)input[0];
+        bool        force = input[1] & 1;
+        auto        text  = input.substr(2);
+
+        auto lines = sm::word_wrap(text, width, force);
+
+        // Wrapping only drops delimiters, and forced lines fit the width
+        std::size_t characters = 0;
+        for (auto &line : lines) characters += line.size();
+        if (characters > text.size())
+        {
+            fuzz::fail("word_wrap made up characters", input);
+        }
+        if (force)
+        {
+            for (auto &line : lines)
+            {
+                if (line.size() > width + 1)
+                {
+                    fuzz::fail("word_wrap exceeded forced width", input);
+                }
+            }
+        }
+    });
+}
@@ -0,0 +1,188 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Fuzzing harness limits and replay driver.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <iterator>
+#include <print>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "fuzzer.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace fuzz {
+
+auto current_limits() -> const limits &
+{
+    static const limits instance = []() {
+        limits result;
+        if (const char *ms = std::getenv("ALCELIN_FUZZ_SLOW_MS"))
+        {
+            result.slow_unit = std::chrono::milliseconds(std::atoll(ms));
+        }
+        if (const char *mb = std::getenv("ALCELIN_FUZZ_MEMORY_MB"))
+        {
+            result.memory_mb = std::strtoull(mb, nullptr, 10);
+        }
+        return result;
+    }();
+    return instance;
+}
+
+auto fail(std::string_view reason, std::string_view input) -> void
+{
+    std::println(stderr, "==alcelin fuzz== {} on {} bytes of input", reason,
+        input.size());
+    std::fflush(stderr);
+    std::abort();
+}
+
+} // namespace fuzz
+
+/**
+ *  @brief   Add the limits to libFuzzer's flags, before the user's flags so
+ *           they can be overridden.
+ *
+ *  @param   argc  Argument count.
+ *  @param   argv  Argument values.
+ *  @return  0.
+ */
+extern "C" auto LLVMFuzzerInitialize(int *argc, char ***argv) -> int
+{
+    auto &limit = fuzz::current_limits();
+
+    // Slow units are caught by the harness, the timeout catches hangs
+    static std::vector<std::string> flags = {
+        std::format("-max_len={}", limit.max_input),
+        std::format("-malloc_limit_mb={}", limit.memory_mb),
+        std::format("-timeout={}", limit.hang.count())
+    };
+    static std::vector<char *> arguments;
+
+    arguments.emplace_back((*argv)[0]);
+    for (auto &flag : flags) arguments.emplace_back(flag.data());
+    for (int i = 1; i < *argc; i++) arguments.emplace_back((*argv)[i]);
+    arguments.emplace_back(nullptr);
+
+    *argc = (int)arguments.size() - 1;
+    *argv = arguments.data();
+    return 0;
+}
+
+#ifdef ALCELIN_FUZZ_REPLAY
+
+extern "C" auto LLVMFuzzerTestOneInput(
+    const std::uint8_t *data,
+    std::size_t         size
+) -> int;
+
+/**
+ *  @brief   Run one input file through the fuzz target.
+ *  @param   path  Input file.
+ */
+static auto replay(const std::filesystem::path &path) -> void
+{
+    std::ifstream input(path, std::ios::binary);
+    auto          data = std::vector<std::uint8_t>(
+        std::istreambuf_iterator<char>(input), {});
+
+#if defined(__unix__) || defined(__APPLE__)
+    // Hangs never return to the harness, let the alarm kill the process
+    alarm(fuzz::current_limits().hang.count());
+    LLVMFuzzerTestOneInput(data.data(), data.size());
+    alarm(0);
+#else
+    LLVMFuzzerTestOneInput(data.data(), data.size());
+#endif
+}
+
+/**
+ *  @brief   Replay inputs through the fuzz target without a fuzzing engine,
+ *           like the seed corpus or crashes, or as AFL's target with @@.
+ *
+ *  Usage: alcelin_fuzz_TARGET FILE_OR_DIRECTORY...
+ *
+ *  @param   argc  Argument count.
+ *  @param   argv  Argument values.
+ *  @return  Exit code, inputs exceeding the limits abort.
+ */
+auto main(int argc, char **argv) -> int
+{
+#if defined(__unix__) || defined(__APPLE__)
+    // Without libFuzzer's malloc limit, allocation bombs fail to allocate
+    rlim_t bytes  = fuzz::current_limits().memory_mb * 1024 * 1024;
+    rlimit memory = { bytes, bytes };
+    setrlimit(RLIMIT_AS, &memory);
+#endif
+
+    std::size_t count = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        std::filesystem::path path = argv[i];
+        if (!std::filesystem::is_directory(path))
+        {
+            replay(path);
+            count++;
+            continue;
+        }
+
+        for (auto &entry : std::filesystem::recursive_directory_iterator(path))
+        {
+            if (!entry.is_regular_file()) continue;
+            replay(entry.path());
+            count++;
+        }
+    }
+
+    std::println("Replayed {} inputs", count);
+    return 0;
+}
+
+#endif // ALCELIN_FUZZ_REPLAY
@@ -0,0 +1,144 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Fuzzing harness with performance-pathology limits.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+
+/**
+ *  @brief  Fuzzing harness for Alcelin.
+ */
+namespace fuzz {
+
+/**
+ *  @brief  Limits an input must stay within, exceeding any is a failure.
+ */
+struct limits {
+
+    /**
+     *  @brief  Inputs larger than this are rejected, pathologies show well
+     *          below it.
+     */
+    std::size_t max_input = 64 * 1024;
+
+    /**
+     *  @brief  Time one input may take, longer inputs are slow units.  Set
+     *          with the ALCELIN_FUZZ_SLOW_MS environment variable.
+     */
+    std::chrono::milliseconds slow_unit = std::chrono::milliseconds(250);
+
+    /**
+     *  @brief  Time after which an input hangs, the process is killed as it
+     *          never returns to the harness.
+     */
+    std::chrono::seconds hang = std::chrono::seconds(10);
+
+    /**
+     *  @brief  Memory in MiB one allocation (libFuzzer) or the process
+     *          (replaying) may use.  Set with the ALCELIN_FUZZ_MEMORY_MB
+     *          environment variable.
+     */
+    std::size_t memory_mb = 256;
+};
+
+/**
+ *  @brief   Get the limits, read from the environment on first use.
+ *  @return  Limits.
+ */
+[[nodiscard]] auto current_limits() -> const limits &;
+
+/**
+ *  @brief  Report a failure with the input causing it, and abort so the
+ *          fuzzing engine keeps the input.
+ *
+ *  @param  reason  What went wrong.
+ *  @param  input   Input causing the failure.
+ */
+[[noreturn]] auto fail(std::string_view reason, std::string_view input)
+    -> void;
+
+/**
+ *  @brief   Run a fuzz target on an input within the limits.
+ *
+ *  Allocation failures are failures: inputs must not make Alcelin allocate
+ *  more than the memory limit.  Other exceptions are the target's to catch.
+ *
+ *  @tparam  target  Callable taking the input as @c std::string_view .
+ *  @param   data    Input data.
+ *  @param   size    Input size in bytes.
+ *  @param   fn      Fuzz target.
+ *  @return  0, or -1 if the input is rejected.
+ */
+template<typename target>
+auto run(const std::uint8_t *data, std::size_t size, target &&fn) -> int
+{
+    auto &limit = current_limits();
+    if (size > limit.max_input) return -1;
+
+    auto input = std::string_view((const char *)data, size);
+    auto start = std::chrono::steady_clock::now();
+    try
+    {
+        fn(input);
+    }
+    catch (const std::bad_alloc &)
+    {
+        fail("allocation bomb (std::bad_alloc)", input);
+    }
+    catch (const std::length_error &)
+    {
+        fail("allocation bomb (std::length_error)", input);
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    if (elapsed > limit.slow_unit)
+    {
+        fail(std::format("slow unit ({} ms)", elapsed.count()), input);
+    }
+    return 0;
+}
+
+} // namespace fuzz
@@ -50,6 +50,9 @@
 #include "alcelin_ansi_escape_codes.hpp" // IWYU pragma: keep
 #include "alcelin_file_utilities.hpp" // IWYU pragma: keep
 #include "alcelin_property.hpp" // IWYU pragma: keep
+#include "alcelin_allocation_counters.hpp" // IWYU pragma: keep
+#include "alcelin_trace.hpp" // IWYU pragma: keep
+#include "alcelin_cpu_dispatch.hpp" // IWYU pragma: keep
 // uncrustify:on
 
 /**
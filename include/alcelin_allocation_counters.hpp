@@ -0,0 +1,319 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Allocation counting instrumentation for Alcelin's functions.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+/**
+ *  @brief   Count the allocations made by the enclosing function.
+ *
+ *  Place at the top of a function body.  Expands to nothing unless Alcelin is
+ *  built with @c ALCELIN_INSTRUMENT_ALLOCS , in which case the calls to the
+ *  function and the allocations made until it returns are added to the
+ *  counters named @c name .
+ *
+ *  @param   name  Function name as string literal, like "sm::split".
+ */
+#ifdef ALCELIN_INSTRUMENT_ALLOCS
+#define ALCELIN_COUNT_ALLOCS(name)                                      \
+    ::alcelin::ac::scope alcelin_ac_scope([]                            \
+        -> ::alcelin::ac::function_counters *                           \
+    {                                                                   \
+        if consteval { return nullptr; }                                \
+        else                                                            \
+        {                                                               \
+            static auto &counters = ::alcelin::ac::counters_for(name);  \
+            return &counters;                                           \
+        }                                                               \
+    }())
+#else
+#define ALCELIN_COUNT_ALLOCS(name) static_cast<void>(0)
+#endif
+
+/**
+ *  @brief  All Alcelin's contents in this namespace.
+ */
+namespace alcelin {
+
+/**
+ *  @brief  Allocation Counters.
+ *
+ *  Opt-in instrumentation reporting which Alcelin functions allocate and how
+ *  much.  Build with the CMake option @c ALCELIN_INSTRUMENT_ALLOCS to count the
+ *  calls and allocations of Alcelin's functions.  Without it, nothing is
+ *  counted and @c report returns no counters.
+ *
+ *  Allocations are seen by a counting @c operator @c new , which the library
+ *  does not replace by itself.  Link the @c alcelin_alloc_hooks target into
+ *  the program to use Alcelin's, or call @c record_allocation from the
+ *  program's own replacement of @c operator @c new .
+ *
+ *  Counts are inclusive, allocations made by a nested Alcelin call are also
+ *  counted for every caller.  Only allocations from the calling thread are
+ *  counted for a call.
+ *
+ *  @note   Over-aligned allocations are not counted.
+ */
+namespace ac {
+
+/**
+ *  @brief  True if Alcelin was built with allocation counting.
+ */
+#ifdef ALCELIN_INSTRUMENT_ALLOCS
+inline constexpr bool instrumented = true;
+#else
+inline constexpr bool instrumented = false;
+#endif
+
+/**
+ *  @brief  Live counters of a function.
+ */
+struct function_counters {
+
+    /**
+     *  @brief  Function name.
+     */
+    std::string_view function;
+
+    /**
+     *  @brief  Number of calls.
+     */
+    std::atomic<std::size_t> calls = 0;
+
+    /**
+     *  @brief  Number of allocations made during the calls.
+     */
+    std::atomic<std::size_t> allocations = 0;
+
+    /**
+     *  @brief  Number of bytes allocated during the calls.
+     */
+    std::atomic<std::size_t> bytes = 0;
+};
+
+/**
+ *  @brief  Counters of a function at the time of the query.
+ */
+struct function_report {
+
+    /**
+     *  @brief  Function name.
+     */
+    std::string_view function;
+
+    /**
+     *  @brief  Number of calls.
+     */
+    std::size_t calls = 0;
+
+    /**
+     *  @brief  Number of allocations made during the calls.
+     */
+    std::size_t allocations = 0;
+
+    /**
+     *  @brief  Number of bytes allocated during the calls.
+     */
+    std::size_t bytes = 0;
+};
+
+/**
+ *  @brief  Allocations made by a thread.
+ */
+struct thread_counters {
+
+    /**
+     *  @brief  Number of allocations.
+     */
+    std::size_t allocations = 0;
+
+    /**
+     *  @brief  Number of bytes allocated.
+     */
+    std::size_t bytes = 0;
+
+    /**
+     *  @brief  Depth of @c suspend , allocations are not counted while
+     *          nonzero.
+     */
+    std::size_t suspended = 0;
+};
+
+/**
+ *  @brief  Allocations made by the current thread since it started.
+ */
+inline thread_local constinit thread_counters this_thread = {};
+
+/**
+ *  @brief  Count an allocation made by the current thread.  The counting
+ *          @c operator @c new calls this, call it from the program's own
+ *          replacement of @c operator @c new if it has one.
+ *
+ *  @param  bytes  Number of bytes allocated.
+ */
+inline auto record_allocation(std::size_t bytes) noexcept -> void
+{
+    if (this_thread.suspended) return;
+    this_thread.allocations++;
+    this_thread.bytes += bytes;
+}
+
+/**
+ *  @brief  Stops counting allocations of the current thread while alive.
+ */
+struct suspend {
+
+    /**
+     *  @brief  Stop counting.
+     */
+    inline suspend()
+    {
+        this_thread.suspended++;
+    }
+
+    suspend(const suspend &) = delete;
+    auto operator= (const suspend &) -> suspend & = delete;
+
+    /**
+     *  @brief  Resume counting.
+     */
+    inline ~suspend()
+    {
+        this_thread.suspended--;
+    }
+};
+
+/**
+ *  @brief   Get the counters of a function, creating them if they do not
+ *           exist.  The counters live until the program exits.
+ *
+ *  @param   function  Function name, must outlive the program.
+ *  @return  Counters of the function.
+ */
+[[nodiscard]] auto counters_for(std::string_view function)
+    -> function_counters &;
+
+/**
+ *  @brief   Get the counters of every function called at least once, with the
+ *           most allocated bytes first.
+ *
+ *  @return  Counters of every function.
+ */
+[[nodiscard]] auto report() -> std::vector<function_report>;
+
+/**
+ *  @brief   Get the counters of a function.
+ *
+ *  @param   function  Function name, like "sm::split".
+ *  @return  Counters of the function, if it was called at least once.
+ */
+[[nodiscard]] auto find(std::string_view function)
+    -> std::optional<function_report>;
+
+/**
+ *  @brief  Set every function's counters to zero.
+ */
+auto reset() -> void;
+
+/**
+ *  @brief  Counts a call and the allocations made until the end of the
+ *          scope.  Use @c ALCELIN_COUNT_ALLOCS instead of using this
+ *          directly.
+ */
+struct scope {
+
+    /**
+     *  @brief  Counters to add to, nothing is counted if null.
+     */
+    function_counters *counters = nullptr;
+
+    /**
+     *  @brief  Thread's allocations at the start of the scope.
+     */
+    std::size_t allocations = 0;
+
+    /**
+     *  @brief  Thread's allocated bytes at the start of the scope.
+     */
+    std::size_t bytes = 0;
+
+    /**
+     *  @brief  Count a call and start counting allocations.
+     *  @param  counters  Counters to add to.
+     */
+    inline constexpr scope(function_counters *counters) : counters(counters)
+    {
+        if consteval { return; }
+        else
+        {
+            if (!counters) return;
+            counters->calls.fetch_add(1, std::memory_order_relaxed);
+            allocations = this_thread.allocations;
+            bytes       = this_thread.bytes;
+        }
+    }
+
+    scope(const scope &) = delete;
+    auto operator= (const scope &) -> scope & = delete;
+
+    /**
+     *  @brief  Add the allocations made during the scope to the counters.
+     */
+    inline constexpr ~scope()
+    {
+        if consteval { return; }
+        else
+        {
+            if (!counters) return;
+            counters->allocations.fetch_add(this_thread.allocations
+                - allocations, std::memory_order_relaxed);
+            counters->bytes.fetch_add(this_thread.bytes - bytes,
+                std::memory_order_relaxed);
+        }
+    }
+};
+
+} // namespace ac
+
+} // namespace alcelin
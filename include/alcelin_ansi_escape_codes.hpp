@@ -42,6 +42,8 @@
 #include <ostream>
 #include <string>
 
+#include "alcelin_allocation_counters.hpp"
+
 /**
  *  @brief  All Alcelin's contents in this namespace.
  */
@@ -66,6 +68,8 @@ inline constinit std::string_view csi = "\x1b\x5b";
  */
 [[nodiscard]] inline constexpr auto sgr(std::string_view code)
 {
+    ALCELIN_COUNT_ALLOCS("aec::sgr");
+
     ///  @todo  After C++26 remove this cast to std::string.
     return std::string(csi) + std::string(code) + "m";
 }
@@ -117,6 +121,8 @@ struct aec_t {
      */
     [[nodiscard]] inline constexpr auto operator() (std::string_view text) const
     {
+        ALCELIN_COUNT_ALLOCS("aec::aec_t::operator()");
+
         ///  @todo  After C++26 remove this cast to std::string.
         return setter + std::string(text) + resetter;
     }
@@ -166,6 +172,8 @@ struct aec_t {
  */
 [[nodiscard]] inline constexpr auto combine(const aec_t a, const aec_t b)
 {
+    ALCELIN_COUNT_ALLOCS("aec::combine");
+
     return aec_t { a.setter + b.setter, a.resetter + b.resetter };
 }
 
@@ -220,6 +228,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto color(unsigned char color)
 {
+    ALCELIN_COUNT_ALLOCS("aec::color");
+
     return aec_t { sgr(std::format("38;5;{}", color)), sgr("39") };
 }
 
@@ -231,6 +241,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto color_bg(unsigned char color)
 {
+    ALCELIN_COUNT_ALLOCS("aec::color_bg");
+
     return aec_t { sgr(std::format("48;5;{}", color)), sgr("49") };
 }
 
@@ -248,6 +260,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
     unsigned char b
 )
 {
+    ALCELIN_COUNT_ALLOCS("aec::color");
+
     return aec_t { sgr(std::format("38;2;{};{};{}", r, g, b)), sgr("39") };
 }
 
@@ -265,6 +279,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
     unsigned char b
 )
 {
+    ALCELIN_COUNT_ALLOCS("aec::color_bg");
+
     return aec_t { sgr(std::format("48;2;{};{};{}", r, g, b)), sgr("49") };
 }
 
@@ -274,6 +290,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto cuu(int n = 1)
 {
+    ALCELIN_COUNT_ALLOCS("aec::cuu");
+
     return std::string(csi) + std::to_string(n) + "A";
 }
 
@@ -283,6 +301,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto cud(int n = 1)
 {
+    ALCELIN_COUNT_ALLOCS("aec::cud");
+
     return std::string(csi) + std::to_string(n) + "B";
 }
 
@@ -292,6 +312,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto cuf(int n = 1)
 {
+    ALCELIN_COUNT_ALLOCS("aec::cuf");
+
     return std::string(csi) + std::to_string(n) + "C";
 }
 
@@ -301,6 +323,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto cub(int n = 1)
 {
+    ALCELIN_COUNT_ALLOCS("aec::cub");
+
     return std::string(csi) + std::to_string(n) + "D";
 }
 
@@ -310,6 +334,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto cha(int x)
 {
+    ALCELIN_COUNT_ALLOCS("aec::cha");
+
     return std::string(csi) + std::to_string(x) + "G";
 }
 
@@ -321,6 +347,8 @@ inline const aec_t bright_white_bg   = { sgr("107"), sgr("49") };
  */
 [[nodiscard]] inline constexpr auto cup(int x, int y)
 {
+    ALCELIN_COUNT_ALLOCS("aec::cup");
+
     return std::string(csi) + std::to_string(y) + ";" + std::to_string(x) + "H";
 }
 
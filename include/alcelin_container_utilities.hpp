@@ -40,16 +40,27 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <cmath>
+#include <compare>
+#include <concepts>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <iterator>
+#include <memory>
 #include <ranges>
+#include <span>
 #include <string>
 #include <string_view>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "alcelin_allocation_counters.hpp"
+#include "alcelin_trace.hpp"
+
 /**
  *  @brief  All Alcelin's contents in this namespace.
  */
@@ -110,6 +121,21 @@ concept cu_compatible_nested =
     cu_compatible<container>
  && cu_compatible<value_type<container>>;
 
+/**
+ *  @brief   Type that can be stored in a hash set of Container Utilities.
+ *
+ *  The type must be hashable with @c std::hash , equality comparable and
+ *  semiregular.
+ *
+ *  @tparam  type  Value type.
+ */
+template<typename type>
+concept cu_hashable = std::semiregular<type>
+    && std::equality_comparable<type>
+    && requires(const type &value) {
+    { std::hash<type> {}(value) } -> std::convertible_to<std::size_t>;
+};
+
 /**
  *  @brief   Container Utilities compatible enumerator for @c enumerated_array .
  *
@@ -140,6 +166,38 @@ struct enum_max : std::integral_constant<std::underlying_type_t<enum_type>,
 template<cu_compatible_enum enum_type>
 inline constexpr auto enum_max_v = enum_max<enum_type>::value;
 
+/**
+ *  @brief   Get the subset of the container's elements without copying them.
+ *
+ *  @tparam  container  Compatible container type.
+ *  @param   ctr        Container.
+ *  @param   first      First index (inclusive).
+ *  @param   last       Last index (exclusive).
+ *  @param   clamp      Clamp the indices to the container instead of requiring
+ *                      them to be valid, like @c boundless_access (optional).
+ *  @return  Subset of the container as @c std::span .
+ *
+ *  @note    The span is invalidated with the container's iterators.
+ */
+template<cu_compatible container>
+[[nodiscard]] inline constexpr auto slice(
+    const container &ctr,
+    std::size_t      first,
+    std::size_t      last,
+    bool             clamp = false
+) -> std::span<const value_type<container>>
+{
+    if (clamp)
+    {
+        last  = std::min(last, (std::size_t)(ctr.end() - ctr.begin()));
+        first = std::min(first, last);
+    }
+
+    return std::span<const value_type<container>>(
+        std::to_address(ctr.begin()) + first,
+        last - first);
+}
+
 /**
  *  @brief   Get the subset of the container's elements.
  *
@@ -148,17 +206,20 @@ inline constexpr auto enum_max_v = enum_max<enum_type>::value;
  *  @param   first      First index (inclusive).
  *  @param   last       Last index (exclusive).
  *  @return  Subset of the container as @c result_container .
+ *
+ *  @see     slice to not copy the elements.
  */
 template<cu_compatible container>
 [[nodiscard]] inline constexpr auto subordinate(
     const container &ctr,
     std::size_t      first,
     std::size_t      last
-)
+) -> result_container<container>
 {
-    return result_container<container>(
-        ctr.begin() + first,
-        ctr.begin() + last);
+    ALCELIN_COUNT_ALLOCS("cu::subordinate");
+
+    auto sub = slice(ctr, first, last);
+    return result_container<container>(sub.begin(), sub.end());
 }
 
 /**
@@ -173,8 +234,10 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto combine(
     const container &ctr_a,
     const container &ctr_b
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::combine");
+
     return result_container_nested<container> {
         result_container<container>(ctr_a.begin(), ctr_a.end()),
         result_container<container>(ctr_b.begin(), ctr_b.end())
@@ -194,8 +257,10 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto combine(
     const container             &ctr,
     const value_type<container> &value
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::combine");
+
     return combine(ctr, result_container<container> { value });
 }
 
@@ -211,33 +276,286 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto filter_out_seq(
     const container &ctr,
     const container &pattern
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::filter_out_seq");
+    ALCELIN_TRACE_ZONE("cu::filter_out_seq");
+
     return std::views::split(ctr, pattern)
          | std::views::join
          | std::ranges::to<result_container<container>>();
 }
 
+/**
+ *  @brief  How @c filter_out_occ finds the elements in the values.
+ */
+enum class filter_strategy {
+    unknown = -1,
+    automatic, // Pick by the sizes and whether the containers are sorted
+    linear,    // Search the values for each element
+    sorted,    // Merge with sorted values, binary search if not sorted
+    hashed,    // Look up in a hash set of the values
+    max
+};
+
+/**
+ *  @brief   Convert filter strategy to string.
+ *
+ *  @param   strategy  Filter strategy.
+ *  @return  String representation of filter strategy.
+ */
+[[nodiscard]] inline constexpr auto to_string(filter_strategy strategy)
+{
+    using namespace std::string_literals;
+    switch (strategy)
+    {
+        case filter_strategy::unknown: return "unknown"s;
+        case filter_strategy::automatic: return "automatic"s;
+        case filter_strategy::linear: return "linear"s;
+        case filter_strategy::sorted: return "sorted"s;
+        case filter_strategy::hashed: return "hashed"s;
+        case filter_strategy::max: return "max"s;
+    }
+    return ""s;
+}
+
+/**
+ *  @brief  Most values @c filter_strategy::automatic searches linearly, above
+ *          which building a set is cheaper (see the @c cu::filter_out_occ
+ *          benchmarks).
+ */
+inline constexpr std::size_t filter_linear_max = 8;
+
+/**
+ *  @brief  Implementation details of Container Utilities, not part of the
+ *          API.
+ */
+namespace detail {
+
+/**
+ *  @brief   Open addressing hash set of values, with linear probing.
+ *
+ *  Built once and looked up many times, used by @c filter_out_occ .
+ *
+ *  @tparam  type  Value type.
+ */
+template<cu_hashable type>
+struct hashed_values {
+
+    /**
+     *  @brief  Values, at the slots their hash picks or after.
+     */
+    std::vector<type> slots;
+
+    /**
+     *  @brief  Whether each slot has a value.
+     */
+    std::vector<unsigned char> used;
+
+    /**
+     *  @brief  Shift of the hash to pick a slot.
+     */
+    int shift = 0;
+
+    /**
+     *  @brief  Build the set of values.
+     *
+     *  @param  first  Iterator to the first value.
+     *  @param  last   Iterator past the last value.
+     */
+    template<typename iterator>
+    inline constexpr hashed_values(iterator first, iterator last)
+    {
+        // At most half full to keep the probes short
+        auto size = std::bit_ceil(std::max<std::size_t>(
+            2 * std::distance(first, last), 2));
+        slots.resize(size);
+        used.resize(size);
+        shift = 64 - std::countr_zero(size);
+
+        for (; first != last; ++first)
+        {
+            auto i = slot(*first);
+            while (used[i] && !(slots[i] == *first)) i = (i + 1) & (size - 1);
+            slots[i] = *first;
+            used[i]  = true;
+        }
+    }
+
+    /**
+     *  @brief   Get the slot a value's hash picks.
+     *
+     *  @param   value  Value.
+     *  @return  Slot index.
+     */
+    [[nodiscard]] inline constexpr auto slot(const type &value) const
+        -> std::size_t
+    {
+        // Fibonacci hashing spreads the identity hashes of integers
+        auto hash = (std::uint64_t)std::hash<type> {}(value);
+        return (std::size_t)(hash * 0x9E3779B97F4A7C15ull >> shift);
+    }
+
+    /**
+     *  @brief   Check if the set has a value.
+     *
+     *  @param   value  Value.
+     *  @return  True if the set has the value.
+     */
+    [[nodiscard]] inline constexpr auto contains(const type &value) const
+        -> bool
+    {
+        for (auto i = slot(value); used[i]; i = (i + 1) & (slots.size() - 1))
+        {
+            if (slots[i] == value) return true;
+        }
+        return false;
+    }
+};
+
+/**
+ *  @brief   Find the first value not less than a value in sorted values,
+ *           galloping from the first.
+ *
+ *  @tparam  iterator  Random access iterator type.
+ *  @tparam  type      Value type.
+ *  @param   first     Iterator to the first value.
+ *  @param   last      Iterator past the last value.
+ *  @param   value     Value to find.
+ *  @return  Iterator to the first value not less than @c value .
+ */
+template<std::random_access_iterator iterator, typename type>
+[[nodiscard]] inline constexpr auto gallop(
+    iterator    first,
+    iterator    last,
+    const type &value
+) -> iterator
+{
+    std::size_t size  = last - first;
+    std::size_t bound = 1;
+    while (bound < size && first[bound] < value) bound *= 2;
+    return std::lower_bound(first + bound / 2,
+        first + std::min(bound + 1, size), value);
+}
+
+} // namespace detail
+
 /**
  *  @brief   Filter out the occurrences of any of values from the container.
  *
+ *  Many values are looked up in a hash set or sorted copy of the values
+ *  instead of searched for each element, sorted containers and values are
+ *  merged without allocating.  Elements keep their order either way.
+ *
  *  @tparam  container  Compatible container type.
  *  @param   ctr        Container.
  *  @param   values     Elements to remove.
+ *  @param   strategy   How to find the elements in the values (optional),
+ *                      strategies the value type does not support fall back
+ *                      to the others.
  *  @return  Filtered container as @c result_container .
  */
 template<cu_compatible container>
 [[nodiscard]] inline constexpr auto filter_out_occ(
     const container &ctr,
-    const container &values
-)
+    const container &values,
+    filter_strategy  strategy = filter_strategy::automatic
+) -> result_container<container>
 {
-    auto filterer = [&](const cu::value_type<container> &element) {
-        return std::ranges::find(values, element) == values.end();
+    ALCELIN_COUNT_ALLOCS("cu::filter_out_occ");
+    ALCELIN_TRACE_ZONE("cu::filter_out_occ");
+
+    using type = value_type<container>;
+    constexpr bool sortable = std::totally_ordered<type>
+                           && std::copyable<type>;
+
+    auto keep = [&](auto &&contains) {
+        return std::views::filter(ctr, [&](const type &element) {
+            return !contains(element);
+        }) | std::ranges::to<result_container<container>>();
+    };
+    auto linear = [&](const type &element) {
+        return std::ranges::find(values, element) != values.end();
     };
 
-    return std::views::filter(ctr, filterer)
-         | std::ranges::to<result_container<container>>();
+    if consteval
+    {
+        return keep(linear);
+    }
+
+    if (strategy == filter_strategy::automatic)
+    {
+        auto size = (std::size_t)(values.end() - values.begin());
+        if (size <= filter_linear_max) strategy = filter_strategy::linear;
+        else if (cu_hashable<type>) strategy = filter_strategy::hashed;
+        else strategy = filter_strategy::sorted;
+
+        if constexpr (sortable)
+        {
+            if (strategy != filter_strategy::linear
+             && std::ranges::is_sorted(values) && std::ranges::is_sorted(ctr))
+            {
+                strategy = filter_strategy::sorted;
+            }
+        }
+    }
+
+    if (strategy == filter_strategy::hashed)
+    {
+        if constexpr (cu_hashable<type>)
+        {
+            if constexpr (std::is_integral_v<type> && sizeof (type) == 1)
+            {
+                // Bytes are their own perfect hash
+                std::array<bool, 256> table = {};
+                for (auto &value : values) table[(unsigned char)value] = true;
+                return keep([&](const type &element) {
+                    return table[(unsigned char)element];
+                });
+            }
+            else
+            {
+                detail::hashed_values<type> set(values.begin(), values.end());
+                return keep([&](const type &element) {
+                    return set.contains(element);
+                });
+            }
+        }
+        else
+        {
+            strategy = filter_strategy::sorted;
+        }
+    }
+
+    if (strategy == filter_strategy::sorted)
+    {
+        if constexpr (sortable)
+        {
+            if (std::ranges::is_sorted(values) && std::ranges::is_sorted(ctr))
+            {
+                // Values only move forward, gallop to skip the runs
+                result_container<container> result;
+                auto it = values.begin();
+                for (auto &element : ctr)
+                {
+                    it = detail::gallop(it, values.end(), element);
+                    if (it == values.end() || !(*it == element))
+                    {
+                        result.emplace_back(element);
+                    }
+                }
+                return result;
+            }
+
+            result_container<container> sorted(values.begin(), values.end());
+            std::ranges::sort(sorted);
+            return keep([&](const type &element) {
+                return std::ranges::binary_search(sorted, element);
+            });
+        }
+    }
+
+    return keep(linear);
 }
 
 /**
@@ -253,8 +571,11 @@ template<cu_compatible container, cu_compatible_nested nested_container>
 [[nodiscard]] inline constexpr auto filter_out_occ_seq(
     const container        &ctr,
     const nested_container &patterns
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::filter_out_occ_seq");
+    ALCELIN_TRACE_ZONE("cu::filter_out_occ_seq");
+
     result_container<container> result = ctr;
     for (auto &pattern : patterns)
     {
@@ -275,8 +596,11 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto filter_out(
     const container             &ctr,
     const value_type<container> &value
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::filter_out");
+    ALCELIN_TRACE_ZONE("cu::filter_out");
+
     return filter_out_seq(ctr, result_container<container> { value });
 }
 
@@ -294,8 +618,10 @@ requires(std::is_integral_v<count> && !std::is_floating_point_v<count>)
 [[nodiscard]] inline constexpr auto repeat(
     const container &ctr,
     count            n
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::repeat");
+
     return std::views::repeat(ctr, n)
          | std::views::join
          | std::ranges::to<result_container<container>>();
@@ -322,8 +648,10 @@ requires(!std::is_integral_v<count> && std::is_floating_point_v<count>)
 [[nodiscard]] inline constexpr auto repeat(
     const container &ctr,
     count            n
-)
+) -> result_container<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::repeat");
+
     // Performance-critical, don't use exceptions
     if (n < 0.0l) n = 0.0l;
 
@@ -331,9 +659,11 @@ requires(!std::is_integral_v<count> && std::is_floating_point_v<count>)
     count       f_part         = std::modf(n, &i_part);
     std::size_t regular_repeat = i_part;
     std::size_t sub_size       = std::floor(f_part * ctr.size());
-    container   sub = subordinate(ctr, 0, sub_size);
 
-    return combine(repeat(ctr, regular_repeat), sub);
+    auto result = repeat(ctr, regular_repeat);
+    auto sub    = slice(ctr, 0, sub_size);
+    result.insert(result.end(), sub.begin(), sub.end());
+    return result;
 }
 
 /**
@@ -348,8 +678,11 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto split_seq(
     const container &ctr,
     const container &pattern
-)
+) -> result_container_nested<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::split_seq");
+    ALCELIN_TRACE_ZONE("cu::split_seq");
+
     return std::views::split(ctr, pattern)
          | std::ranges::to<result_container_nested<container>>();
 }
@@ -366,8 +699,11 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto split_occ(
     const container &ctr,
     const container &values
-)
+) -> result_container_nested<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::split_occ");
+    ALCELIN_TRACE_ZONE("cu::split_occ");
+
     // Couldn't find standard library to do this heavy job, so...
     result_container_nested<container> result;
     auto it = ctr.begin();
@@ -390,15 +726,19 @@ template<cu_compatible container>
  *  @tparam  container        Compatible container type.
  *  @tparam  nested_container  Compatible container type nested container type.
  *  @param   ctr              Container.
- *  @param   patterns         Patterns to split with.
+ *  @param   patterns         Patterns to split with, empty ones are
+ *                            ignored.
  *  @return  Split container as @c result_container_nested .
  */
 template<cu_compatible container, cu_compatible_nested nested_container>
 [[nodiscard]] inline constexpr auto split_occ_seq(
     const container        &ctr,
     const nested_container &patterns
-)
+) -> result_container_nested<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::split_occ_seq");
+    ALCELIN_TRACE_ZONE("cu::split_occ_seq");
+
     // Again couldn't find standard library to do this heavy job, so...
     result_container_nested<container> result;
     auto it = ctr.begin();
@@ -409,6 +749,9 @@ template<cu_compatible container, cu_compatible_nested nested_container>
         std::size_t pattern_size = (std::size_t)-1;
         for (auto &pattern : patterns)
         {
+            // An empty pattern matches everywhere without advancing
+            if (pattern.size() == 0) continue;
+
             // Use std::search instead of std::find_first_of to find sequence
             auto tmp = std::search(it, ctr.end(), pattern.begin(),
                 pattern.end());
@@ -440,11 +783,528 @@ template<cu_compatible container>
 [[nodiscard]] inline constexpr auto split(
     const container             &ctr,
     const value_type<container> &value
-)
+) -> result_container_nested<container>
 {
+    ALCELIN_COUNT_ALLOCS("cu::split");
+    ALCELIN_TRACE_ZONE("cu::split");
+
     return split_seq(ctr, result_container<container> { value });
 }
 
+/**
+ *  @brief   Split result with all the pieces in one contiguous buffer.
+ *
+ *  Alternative to @c result_container_nested that makes two allocations in
+ *  total regardless of the number of pieces: the values of every piece back
+ *  to back, and the offset each piece ends at.  Pieces are views into the
+ *  values, and iterating the result iterates the pieces like a nested
+ *  container.
+ *
+ *  @tparam  type  Value type.
+ *  @tparam  view  Piece type, constructible from a pointer and a size.
+ *
+ *  @note    Pieces are invalidated when the result is modified or destroyed.
+ */
+template<typename type, typename view = std::span<const type>>
+struct split_result {
+
+    /**
+     *  @brief  Random access iterator over the pieces.
+     */
+    struct iterator {
+        /**
+         *  @brief  Iterator types of the standard library.
+         */
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = view;
+        using difference_type   = std::ptrdiff_t;
+
+        /**
+         *  @brief  Result being iterated.
+         */
+        const split_result *result = nullptr;
+
+        /**
+         *  @brief  Index of the piece.
+         */
+        std::size_t index = 0;
+
+        /**
+         *  @brief  Get the piece.
+         */
+        [[nodiscard]] inline constexpr auto operator* () const -> view
+        {
+            return (*result)[index];
+        }
+
+        /**
+         *  @brief  Get the piece @c n pieces away.
+         */
+        [[nodiscard]] inline constexpr auto operator[] (
+            difference_type n
+        ) const -> view
+        {
+            return (*result)[index + n];
+        }
+
+        /**
+         *  @brief  Go to the next piece.
+         */
+        inline constexpr auto operator++ () -> iterator &
+        {
+            index++;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go to the next piece, return the previous.
+         */
+        inline constexpr auto operator++ (int) -> iterator
+        {
+            auto copy = *this;
+            index++;
+            return copy;
+        }
+
+        /**
+         *  @brief  Go to the previous piece.
+         */
+        inline constexpr auto operator-- () -> iterator &
+        {
+            index--;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go to the previous piece, return the next.
+         */
+        inline constexpr auto operator-- (int) -> iterator
+        {
+            auto copy = *this;
+            index--;
+            return copy;
+        }
+
+        /**
+         *  @brief  Go @c n pieces forward.
+         */
+        inline constexpr auto operator+= (difference_type n) -> iterator &
+        {
+            index += n;
+            return *this;
+        }
+
+        /**
+         *  @brief  Go @c n pieces backward.
+         */
+        inline constexpr auto operator-= (difference_type n) -> iterator &
+        {
+            index -= n;
+            return *this;
+        }
+
+        /**
+         *  @brief  Get the iterator @c n pieces forward.
+         */
+        [[nodiscard]] friend inline constexpr auto operator+ (
+            iterator        it,
+            difference_type n
+        ) -> iterator
+        {
+            return it += n;
+        }
+
+        /**
+         *  @brief  Get the iterator @c n pieces forward.
+         */
+        [[nodiscard]] friend inline constexpr auto operator+ (
+            difference_type n,
+            iterator        it
+        ) -> iterator
+        {
+            return it += n;
+        }
+
+        /**
+         *  @brief  Get the iterator @c n pieces backward.
+         */
+        [[nodiscard]] friend inline constexpr auto operator- (
+            iterator        it,
+            difference_type n
+        ) -> iterator
+        {
+            return it -= n;
+        }
+
+        /**
+         *  @brief  Get the number of pieces between the iterators.
+         */
+        [[nodiscard]] friend inline constexpr auto operator- (
+            const iterator &a,
+            const iterator &b
+        ) -> difference_type
+        {
+            return (difference_type)a.index - (difference_type)b.index;
+        }
+
+        /**
+         *  @brief  Compare the iterators.
+         */
+        [[nodiscard]] friend inline constexpr auto operator== (
+            const iterator &a,
+            const iterator &b
+        ) -> bool
+        {
+            return a.index == b.index;
+        }
+
+        /**
+         *  @brief  Order the iterators.
+         */
+        [[nodiscard]] friend inline constexpr auto operator<=> (
+            const iterator &a,
+            const iterator &b
+        )
+        {
+            return a.index <=> b.index;
+        }
+    };
+
+    /**
+     *  @brief  Values of every piece, back to back.
+     */
+    std::vector<type> values;
+
+    /**
+     *  @brief  Offset in @c values where each piece ends.
+     */
+    std::vector<std::size_t> offsets;
+
+    /**
+     *  @brief   Get the number of pieces.
+     *  @return  Number of pieces.
+     */
+    [[nodiscard]] inline constexpr auto size() const -> std::size_t
+    {
+        return offsets.size();
+    }
+
+    /**
+     *  @brief   Check if there are no pieces.
+     *  @return  True if there are no pieces.
+     */
+    [[nodiscard]] inline constexpr auto empty() const -> bool
+    {
+        return offsets.empty();
+    }
+
+    /**
+     *  @brief   Get a piece.
+     *
+     *  @param   index  Index of the piece.
+     *  @return  Piece as @c view .
+     */
+    [[nodiscard]] inline constexpr auto operator[] (std::size_t index) const
+        -> view
+    {
+        std::size_t first = index == 0 ? 0 : offsets[index - 1];
+        return view(values.data() + first, offsets[index] - first);
+    }
+
+    /**
+     *  @brief   Get the iterator to the first piece.
+     *  @return  Iterator.
+     */
+    [[nodiscard]] inline constexpr auto begin() const -> iterator
+    {
+        return iterator { this, 0 };
+    }
+
+    /**
+     *  @brief   Get the iterator past the last piece.
+     *  @return  Iterator.
+     */
+    [[nodiscard]] inline constexpr auto end() const -> iterator
+    {
+        return iterator { this, size() };
+    }
+
+    /**
+     *  @brief  Append a piece.
+     *
+     *  @param  first  Iterator to the first value of the piece.
+     *  @param  last   Iterator past the last value of the piece.
+     */
+    template<typename iterator_type>
+    inline constexpr auto append(iterator_type first, iterator_type last)
+        -> void
+    {
+        values.insert(values.end(), first, last);
+        offsets.emplace_back(values.size());
+    }
+};
+
+/**
+ *  @brief   Make a split result by walking the pieces twice, first to count
+ *           them and reserve exactly, then to copy them.
+ *
+ *  @tparam  result  Split result type.
+ *  @tparam  walker  Type of @c walk .
+ *  @param   walk    Function calling its argument with the first and last
+ *                   iterator of every piece.
+ *  @return  Split result.
+ */
+template<typename result, typename walker>
+[[nodiscard]] inline constexpr auto make_split_result(walker walk) -> result
+{
+    std::size_t pieces = 0;
+    std::size_t values = 0;
+    walk([&](auto first, auto last) {
+        pieces++;
+        values += std::distance(first, last);
+    });
+
+    result split;
+    split.values.reserve(values);
+    split.offsets.reserve(pieces);
+    walk([&](auto first, auto last) { split.append(first, last); });
+    return split;
+}
+
+/**
+ *  @brief   Split the container with pattern, into one buffer.
+ *
+ *  @tparam  container  Compatible container type.
+ *  @param   ctr        Container.
+ *  @param   pattern    Pattern to split with.
+ *  @return  Split container as @c split_result .
+ *
+ *  @see     split_seq.
+ */
+template<cu_compatible container>
+[[nodiscard]] inline constexpr auto split_seq_flat(
+    const container &ctr,
+    const container &pattern
+) -> split_result<value_type<container>>
+{
+    ALCELIN_COUNT_ALLOCS("cu::split_seq_flat");
+    ALCELIN_TRACE_ZONE("cu::split_seq_flat");
+
+    using result = split_result<value_type<container>>;
+    return make_split_result<result>([&](auto &&emit) {
+        for (auto &&piece : std::views::split(ctr, pattern))
+        {
+            emit(piece.begin(), piece.end());
+        }
+    });
+}
+
+/**
+ *  @brief   Split the container with occurrences of value, into one buffer.
+ *
+ *  @tparam  container  Compatible container type.
+ *  @param   ctr        Container.
+ *  @param   values     Values to split with.
+ *  @return  Split container as @c split_result .
+ *
+ *  @see     split_occ.
+ */
+template<cu_compatible container>
+[[nodiscard]] inline constexpr auto split_occ_flat(
+    const container &ctr,
+    const container &values
+) -> split_result<value_type<container>>
+{
+    ALCELIN_COUNT_ALLOCS("cu::split_occ_flat");
+    ALCELIN_TRACE_ZONE("cu::split_occ_flat");
+
+    using result = split_result<value_type<container>>;
+    return make_split_result<result>([&](auto &&emit) {
+        auto it = ctr.begin();
+        while (it != ctr.end())
+        {
+            auto next_it = std::find_first_of(it, ctr.end(), values.begin(),
+                values.end());
+            emit(it, next_it);
+            it = next_it;
+            if (it != ctr.end()) ++it;
+        }
+    });
+}
+
+/**
+ *  @brief   Split the container with occurrences of any of pattern, into one
+ *           buffer.
+ *
+ *  @tparam  container        Compatible container type.
+ *  @tparam  nested_container  Compatible container type nested container type.
+ *  @param   ctr              Container.
+ *  @param   patterns         Patterns to split with, empty ones are
+ *                            ignored.
+ *  @return  Split container as @c split_result .
+ *
+ *  @see     split_occ_seq.
+ */
+template<cu_compatible container, cu_compatible_nested nested_container>
+[[nodiscard]] inline constexpr auto split_occ_seq_flat(
+    const container        &ctr,
+    const nested_container &patterns
+) -> split_result<value_type<container>>
+{
+    ALCELIN_COUNT_ALLOCS("cu::split_occ_seq_flat");
+    ALCELIN_TRACE_ZONE("cu::split_occ_seq_flat");
+
+    using result = split_result<value_type<container>>;
+    return make_split_result<result>([&](auto &&emit) {
+        auto it = ctr.begin();
+        while (it != ctr.end())
+        {
+            auto        next_it      = ctr.end();
+            std::size_t pattern_size = (std::size_t)-1;
+            for (auto &pattern : patterns)
+            {
+                if (pattern.size() == 0) continue;
+
+                auto tmp = std::search(it, ctr.end(), pattern.begin(),
+                    pattern.end());
+
+                if (next_it > tmp)
+                {
+                    next_it      = tmp;
+                    pattern_size = pattern.size();
+                }
+            }
+
+            emit(it, next_it);
+            it = next_it;
+            if (it != ctr.end()) it += pattern_size;
+        }
+    });
+}
+
+/**
+ *  @brief   Split the container with value, into one buffer.
+ *
+ *  @tparam  container  Compatible container type.
+ *  @param   ctr        Container.
+ *  @param   value      Value to split with.
+ *  @return  Split container as @c split_result .
+ *
+ *  @see     split.
+ */
+template<cu_compatible container>
+[[nodiscard]] inline constexpr auto split_flat(
+    const container             &ctr,
+    const value_type<container> &value
+) -> split_result<value_type<container>>
+{
+    ALCELIN_COUNT_ALLOCS("cu::split_flat");
+    ALCELIN_TRACE_ZONE("cu::split_flat");
+
+    return split_seq_flat(ctr, result_container<container> { value });
+}
+
+/**
+ *  @brief   Replace the occurrences of sequence in the container.
+ *
+ *  The occurrences are found from the beginning without overlapping.  The
+ *  first pass counts them to allocate the result once, the second pass copies
+ *  the container with the replacements.
+ *
+ *  @tparam  container    Compatible container type.
+ *  @param   ctr          Container.
+ *  @param   pattern      Sequence to replace, nothing is replaced if empty.
+ *  @param   replacement  Sequence to replace with.
+ *  @return  Replaced container as @c result_container .
+ */
+template<cu_compatible container>
+[[nodiscard]] inline constexpr auto replace_seq(
+    const container &ctr,
+    const container &pattern,
+    const container &replacement
+) -> result_container<container>
+{
+    ALCELIN_COUNT_ALLOCS("cu::replace_seq");
+    ALCELIN_TRACE_ZONE("cu::replace_seq");
+
+    if (pattern.size() == 0)
+    {
+        return result_container<container>(ctr.begin(), ctr.end());
+    }
+
+    // Calls keep for the elements between the occurrences, and replace for
+    // each occurrence
+    auto walk = [&](auto &&keep, auto &&replace) {
+        auto it = ctr.begin();
+        while (it != ctr.end())
+        {
+            auto next_it = std::search(it, ctr.end(), pattern.begin(),
+                pattern.end());
+            keep(it, next_it);
+            if (next_it == ctr.end()) break;
+
+            replace();
+            it = next_it + pattern.size();
+        }
+    };
+
+    std::size_t size = 0;
+    walk([&](auto first, auto last) { size += last - first; },
+        [&]() { size += replacement.size(); });
+
+    result_container<container> result;
+    result.reserve(size);
+    walk([&](auto first, auto last) {
+        result.insert(result.end(), first, last);
+    }, [&]() {
+        result.insert(result.end(), replacement.begin(), replacement.end());
+    });
+    return result;
+}
+
+/**
+ *  @brief   Replace the occurrences of any of values in the container.
+ *
+ *  The first pass counts the occurrences to allocate the result once, the
+ *  second pass copies the container with the replacements.
+ *
+ *  @tparam  container    Compatible container type.
+ *  @param   ctr          Container.
+ *  @param   values       Elements to replace.
+ *  @param   replacement  Sequence to replace each element with.
+ *  @return  Replaced container as @c result_container .
+ */
+template<cu_compatible container>
+[[nodiscard]] inline constexpr auto replace_occ(
+    const container &ctr,
+    const container &values,
+    const container &replacement
+) -> result_container<container>
+{
+    ALCELIN_COUNT_ALLOCS("cu::replace_occ");
+    ALCELIN_TRACE_ZONE("cu::replace_occ");
+
+    auto is_value = [&](const value_type<container> &element) {
+        return std::ranges::find(values, element) != values.end();
+    };
+
+    std::size_t count = std::ranges::count_if(ctr, is_value);
+    std::size_t size  = ctr.size() - count + count * replacement.size();
+
+    result_container<container> result;
+    result.reserve(size);
+    for (auto &element : ctr)
+    {
+        if (is_value(element))
+        {
+            result.insert(result.end(), replacement.begin(),
+                replacement.end());
+        }
+        else result.emplace_back(element);
+    }
+    return result;
+}
+
 } // namespace cu
 
 /**
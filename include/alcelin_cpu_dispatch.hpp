@@ -0,0 +1,198 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Runtime CPU feature dispatch of Alcelin's kernels.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+/**
+ *  @brief  All Alcelin's contents in this namespace.
+ */
+namespace alcelin {
+
+/**
+ *  @brief  CPU Dispatch.
+ *
+ *  Kernels compiled for several instruction sets into the library, and
+ *  resolved once at runtime to the best one the CPU supports.  Set the
+ *  ALCELIN_ISA environment variable to the name of an @c isa , like @c avx2 ,
+ *  to use a lower instruction set, like for testing the fallbacks.
+ *
+ *  @note   Only x86 has kernels other than @c isa::baseline .
+ */
+namespace cpu {
+
+/**
+ *  @brief  Instruction sets with kernels, in increasing order.
+ */
+enum class isa {
+    unknown = -1,
+    baseline,
+    sse42,
+    avx2,
+    avx512,
+    max
+};
+
+/**
+ *  @brief   Convert instruction set to string.
+ *
+ *  @param   level  Instruction set.
+ *  @return  String representation of instruction set, as used by ALCELIN_ISA.
+ */
+[[nodiscard]] inline constexpr auto to_string(isa level)
+{
+    using namespace std::string_literals;
+    switch (level)
+    {
+        case isa::unknown: return "unknown"s;
+        case isa::baseline: return "baseline"s;
+        case isa::sse42: return "sse42"s;
+        case isa::avx2: return "avx2"s;
+        case isa::avx512: return "avx512"s;
+        case isa::max: return "max"s;
+    }
+    return ""s;
+}
+
+/**
+ *  @brief  Kernels of an instruction set.
+ *
+ *  Sets are byte sets, like the delimiters of @c sm::trim , and positions are
+ *  @c std::string_view::npos when not found, like in @c std::string_view .
+ */
+struct kernel_table {
+
+    /**
+     *  @brief  Instruction set of the kernels.
+     */
+    isa level = isa::baseline;
+
+    /**
+     *  @brief  Find the first byte of the data in the set.
+     */
+    std::size_t (*find_first_of)(const char *data, std::size_t size,
+        const char *set, std::size_t set_size) = nullptr;
+
+    /**
+     *  @brief  Find the first byte of the data not in the set.
+     */
+    std::size_t (*find_first_not_of)(const char *data, std::size_t size,
+        const char *set, std::size_t set_size) = nullptr;
+
+    /**
+     *  @brief  Find the last byte of the data not in the set.
+     */
+    std::size_t (*find_last_not_of)(const char *data, std::size_t size,
+        const char *set, std::size_t set_size) = nullptr;
+
+    /**
+     *  @brief  Convert ASCII letters to lowercase, from input to output of the
+     *          same size.
+     */
+    void (*to_lower)(char *output, const char *input, std::size_t size)
+        = nullptr;
+
+    /**
+     *  @brief  Convert ASCII letters to uppercase, from input to output of the
+     *          same size.
+     */
+    void (*to_upper)(char *output, const char *input, std::size_t size)
+        = nullptr;
+
+    /**
+     *  @brief  Continue a CRC-32C (Castagnoli) checksum with the data, start
+     *          with 0.
+     */
+    std::uint32_t (*crc32c)(std::uint32_t crc, const void *data,
+        std::size_t size) = nullptr;
+};
+
+/**
+ *  @brief   Get the instruction set by name.
+ *
+ *  @param   name  Name, from @c to_string .
+ *  @return  Instruction set, or @c isa::unknown .
+ */
+[[nodiscard]] inline constexpr auto isa_from_name(std::string_view name)
+{
+    for (int i = 0; i < (int)isa::max; i++)
+    {
+        if (to_string((isa)i) == name) return (isa)i;
+    }
+    return isa::unknown;
+}
+
+/**
+ *  @brief   Get the best instruction set of the CPU, detected once.
+ *  @return  Detected instruction set.
+ */
+[[nodiscard]] auto detected() -> isa;
+
+/**
+ *  @brief   Get the instruction set the kernels use, the detected one unless
+ *           ALCELIN_ISA names a lower one.
+ *
+ *  @return  Active instruction set.
+ */
+[[nodiscard]] auto active() -> isa;
+
+/**
+ *  @brief   Get the kernels of an instruction set.
+ *
+ *  @param   level  Instruction set, at most the detected one.
+ *  @return  Kernels, or the detected instruction set's kernels if @c level is
+ *           higher.
+ */
+[[nodiscard]] auto kernels_for(isa level) -> const kernel_table &;
+
+/**
+ *  @brief   Get the kernels of the active instruction set, resolved on the
+ *           first call.
+ *
+ *  @return  Kernels.
+ */
+[[nodiscard]] auto kernels() -> const kernel_table &;
+
+} // namespace cpu
+
+} // namespace alcelin
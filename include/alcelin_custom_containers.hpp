@@ -218,7 +218,7 @@ struct boundless_vector : std::vector<element_type, alloc> {
     inline constexpr boundless_vector(
         boundless_vector &&vector,
         const alloc       &allocator
-    ) noexcept : base(std::move((base &) vector, allocator)) {}
+    ) noexcept : base(std::move((base &) vector), allocator) {}
 
     /**
      *  @brief  Creates a vector from an initializer list.
@@ -300,7 +300,8 @@ struct boundless_vector : std::vector<element_type, alloc> {
         std::initializer_list<element_type> list
     ) -> boundless_vector &
     {
-        return base::operator= (list);
+        base::operator= (list);
+        return *this;
     }
 
     /**
@@ -311,7 +312,8 @@ struct boundless_vector : std::vector<element_type, alloc> {
      */
     inline constexpr auto operator= (const base &vector) -> boundless_vector &
     {
-        return base::operator= (vector);
+        base::operator= (vector);
+        return *this;
     }
 
     /**
@@ -322,7 +324,8 @@ struct boundless_vector : std::vector<element_type, alloc> {
      */
     inline constexpr auto operator= (base &&vector) -> boundless_vector &
     {
-        return base::operator= (std::move(vector));
+        base::operator= (std::move(vector));
+        return *this;
     }
 
     /**
@@ -40,12 +40,21 @@
 #pragma once
 
 #include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <format>
 #include <fstream>
 #include <ios>
+#include <iterator>
 #include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
+#include "alcelin_allocation_counters.hpp"
+#include "alcelin_trace.hpp"
+
 /**
  *  @brief  All Alcelin's contents in this namespace.
  */
@@ -87,6 +96,9 @@ using sd_chunk = std::vector<unsigned char>;
  */
 [[nodiscard]] inline auto read_all(std::string_view filename)
 {
+    ALCELIN_COUNT_ALLOCS("file::read_all");
+    ALCELIN_TRACE_ZONE("file::read_all");
+
     std::ifstream infile((std::string(filename)));
     if (!infile)
     {
@@ -108,6 +120,8 @@ template<typename type>
 requires(std::is_trivially_copyable_v<type>)
 [[nodiscard]] inline constexpr auto to_sd_chunk(const type &t)
 {
+    ALCELIN_COUNT_ALLOCS("file::to_sd_chunk");
+
     auto     t_size = sizeof (type);
     sd_chunk chunk(t_size);
 
@@ -126,6 +140,8 @@ template<typename type>
 requires(std::is_trivially_copyable_v<type>)
 [[nodiscard]] inline constexpr auto from_sd_chunk(const sd_chunk &chunk)
 {
+    ALCELIN_COUNT_ALLOCS("file::from_sd_chunk");
+
     auto t_size = sizeof (type);
 
     if (t_size != chunk.size())
@@ -148,6 +164,8 @@ requires(std::is_trivially_copyable_v<type>)
  */
 [[nodiscard]] inline constexpr auto read_chunk(std::istream &input)
 {
+    ALCELIN_COUNT_ALLOCS("file::read_chunk");
+
     std::size_t size = 0;
     input.read((char *)&size, sizeof (std::size_t));
 
@@ -167,6 +185,8 @@ requires(std::is_trivially_copyable_v<type>)
     const sd_chunk &chunk
 )
 {
+    ALCELIN_COUNT_ALLOCS("file::write_chunk");
+
     std::size_t size = chunk.size();
     output.write((char *)&size, sizeof (std::size_t));
 
@@ -184,6 +204,8 @@ template<typename type>
 requires(std::is_trivially_copyable_v<type>)
 [[nodiscard]] inline constexpr auto read_data(std::istream &input)
 {
+    ALCELIN_COUNT_ALLOCS("file::read_data");
+
     auto chunk = read_chunk(input);
     return from_sd_chunk<type>(chunk);
 }
@@ -202,6 +224,8 @@ requires(std::is_trivially_copyable_v<type>)
     const type   &t
 )
 {
+    ALCELIN_COUNT_ALLOCS("file::write_data");
+
     auto chunk = to_sd_chunk(t);
     write_chunk(output, chunk);
 }
@@ -39,8 +39,32 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <functional>
+#include <initializer_list>
+#include <istream>
+#include <iterator>
 #include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "alcelin_allocation_counters.hpp"
+#include "alcelin_file_utilities.hpp"
 
 /**
  *  @brief  All Alcelin's contents in this namespace.
@@ -53,446 +77,4132 @@ namespace alcelin {
 namespace prop {
 
 /**
- *  @brief   Property with getter.  Variable read operation will call the getter
- *           to retrieve the value.
- *  @tparam  type  Type to work with.
+ *  @brief  Default storage size (in bytes) of @c inplace_function .  Enough to
+ *          hold a lambda capturing four references or pointers.  Larger
+ *          callables are stored on the heap.
  */
-template<typename type>
-struct property_readonly {
+inline constexpr std::size_t inplace_function_capacity = 4 * sizeof (void *);
+
+/**
+ *  @brief   Type-erased callable that stores the callable inside itself.
+ *  @tparam  signature  Function signature.
+ *  @tparam  capacity   Size of the internal storage in bytes.
+ */
+template<typename signature,
+    std::size_t capacity = inplace_function_capacity>
+struct inplace_function;
+
+/**
+ *  @brief   Type-erased callable that stores the callable inside itself.
+ *
+ *  Calling an empty @c inplace_function throws @c std::bad_function_call ,
+ *  just like @c std::function .  The callable is always called as const, so
+ *  it must be invocable as const (i.e., no @c mutable lambdas).
+ *
+ *  @note    Only callables stored in the internal storage are non-allocating:
+ *           callables larger than @c capacity , over-aligned or that may throw
+ *           when moved are stored on the heap instead, like @c std::function
+ *           does.  Check with @c stored_inplace , or raise @c capacity .
+ *           During constant evaluation, every callable is stored on the heap.
+ *
+ *  @tparam  result    Return type of the callable.
+ *  @tparam  args      Parameter types of the callable.
+ *  @tparam  capacity  Size of the internal storage in bytes.
+ */
+template<typename result, typename ... args, std::size_t capacity>
+struct inplace_function<result(args...), capacity> {
 
     /**
-     *  @brief  Getter function.
+     *  @brief  Operations to manipulate the stored callable.
+     */
+    struct operations {
+
+        /**
+         *  @brief  Call the callable stored in @c storage .
+         */
+        result (*invoke)(const void *storage, args &&... arguments) = nullptr;
+
+        /**
+         *  @brief  Copy-construct the callable from @c source into
+         *          @c destination .
+         */
+        void (*copy)(void *destination, const void *source) = nullptr;
+
+        /**
+         *  @brief  Move the callable from @c source into @c destination , and
+         *          destroy the callable in @c source .
+         */
+        void (*move)(void *destination, void *source) = nullptr;
+
+        /**
+         *  @brief  Destroy the callable stored in @c storage .
+         */
+        void (*destroy)(void *storage) = nullptr;
+    };
+
+    /**
+     *  @brief  Operations for an empty function.
      */
-    std::function<type()> getter;
+    static constexpr operations empty_operations = {
+        .invoke  = [](const void *, args &&...) -> result {
+            throw std::bad_function_call();
+        },
+        .copy    = [](void *, const void *) {},
+        .move    = [](void *, void *) {},
+        .destroy = [](void *) {}
+    };
 
     /**
-     *  @brief  Creates a property with provided getter.
-     *  @param  getter  Getter function.
+     *  @brief  Marks a function storing its callable in @c constant , never
+     *          called.
+     */
+    static constexpr operations constant_operations = {};
+
+    /**
+     *  @brief   Whether a callable of type @c callable is stored in the
+     *           internal storage.
+     *  @tparam  callable  Type of the callable.
+     */
+    template<typename callable>
+    static constexpr bool stored_inplace = sizeof (callable) <= capacity
+        && alignof (callable) <= alignof (std::max_align_t)
+        && std::is_nothrow_move_constructible_v<callable>;
+
+    /**
+     *  @brief   Operations for a callable of type @c callable stored in the
+     *           internal storage.
+     *  @tparam  callable  Type of the stored callable.
+     */
+    template<typename callable>
+    static constexpr operations callable_operations = {
+        .invoke  = [](const void *storage, args &&... arguments) -> result {
+            return std::invoke(*(const callable *)storage,
+                std::forward<args>(arguments)...);
+        },
+        .copy    = [](void *destination, const void *source) {
+            ::new (destination) callable(*(const callable *)source);
+        },
+        .move    = [](void *destination, void *source) {
+            ::new (destination) callable(std::move(*(callable *)source));
+            ((callable *)source)->~callable();
+        },
+        .destroy = [](void *storage) {
+            ((callable *)storage)->~callable();
+        }
+    };
+
+    /**
+     *  @brief   Operations for a callable of type @c callable stored on the
+     *           heap, the internal storage holding a pointer to it.
+     *  @tparam  callable  Type of the stored callable.
+     */
+    template<typename callable>
+    static constexpr operations heap_operations = {
+        .invoke  = [](const void *storage, args &&... arguments) -> result {
+            return std::invoke(**(const callable *const *)storage,
+                std::forward<args>(arguments)...);
+        },
+        .copy    = [](void *destination, const void *source) {
+            ::new (destination) callable *(
+                new callable(**(const callable *const *)source));
+        },
+        .move    = [](void *destination, void *source) {
+            ::new (destination) callable *(*(callable **)source);
+        },
+        .destroy = [](void *storage) {
+            delete *(callable **)storage;
+        }
+    };
+
+    /**
+     *  @brief  Callable stored during constant evaluation, where the internal
+     *          storage cannot be reinterpreted as the callable.
+     */
+    struct constant_callable {
+
+        /**
+         *  @brief  Destroys the callable.
+         */
+        inline constexpr virtual ~constant_callable() = default;
+
+        /**
+         *  @brief   Call the callable.
+         *
+         *  @param   arguments  Arguments to the callable.
+         *  @return  Return value of the callable.
+         */
+        inline constexpr virtual auto invoke(args &&... arguments) const
+            -> result = 0;
+
+        /**
+         *  @brief   Copy the callable.
+         *  @return  Copy allocated with @c new .
+         */
+        inline constexpr virtual auto clone() const
+            -> constant_callable * = 0;
+    };
+
+    /**
+     *  @brief   Callable of type @c callable stored during constant
+     *           evaluation.
+     *  @tparam  callable  Type of the stored callable.
+     */
+    template<typename callable>
+    struct constant_model : constant_callable {
+
+        /**
+         *  @brief  Stored callable.
+         */
+        callable function;
+
+        /**
+         *  @brief   Creates a model storing a copy of @c function .
+         *
+         *  @tparam  from      Type of the callable to store.
+         *  @param   function  Callable to store.
+         */
+        template<typename from>
+        inline constexpr constant_model(from &&function)
+            : function(std::forward<from>(function)) {}
+
+        /**
+         *  @brief  Destroys the callable.
+         */
+        inline constexpr ~constant_model() override = default;
+
+        /**
+         *  @brief   Call the callable.
+         *
+         *  @param   arguments  Arguments to the callable.
+         *  @return  Return value of the callable.
+         */
+        inline constexpr auto invoke(args &&... arguments) const
+            -> result override
+        {
+            return std::invoke(function, std::forward<args>(arguments)...);
+        }
+
+        /**
+         *  @brief   Copy the callable.
+         *  @return  Copy allocated with @c new .
+         */
+        inline constexpr auto clone() const -> constant_callable * override
+        {
+            return new constant_model(function);
+        }
+    };
+
+    union {
+
+        /**
+         *  @brief  Storage of the callable.
+         */
+        alignas(std::max_align_t) unsigned char storage[capacity] = {};
+
+        /**
+         *  @brief  Callable stored during constant evaluation, active when
+         *          @c ops is @c constant_operations .
+         */
+        constant_callable *constant;
+    };
+
+    /**
+     *  @brief  Operations for the stored callable, never null.
+     */
+    const operations *ops = &empty_operations;
+
+    /**
+     *  @brief  Creates an empty function.
+     */
+    inline constexpr inplace_function() = default;
+
+    /**
+     *  @brief  Creates an empty function.
+     */
+    inline constexpr inplace_function(std::nullptr_t) {}
+
+    /**
+     *  @brief   Creates a function that stores a copy of @c function .
+     *
+     *  @tparam  callable  Type of the callable.
+     *  @param   function  Callable to store.
+     */
+    template<typename callable>
+    requires(!std::is_same_v<std::remove_cvref_t<callable>, inplace_function>
+          && std::is_invocable_r_v<result,
+                const std::remove_cvref_t<callable> &, args...>)
+    inline constexpr inplace_function(callable &&function)
+    {
+        using stored = std::remove_cvref_t<callable>;
+
+        static_assert(std::is_copy_constructible_v<stored>,
+            "Callable must be copy constructible");
+        static_assert(capacity >= sizeof (stored *),
+            "Capacity must hold at least a pointer");
+
+        if consteval
+        {
+            constant = new constant_model<stored>(
+                std::forward<callable>(function));
+            ops = &constant_operations;
+        }
+        else
+        {
+            if constexpr (stored_inplace<stored>)
+            {
+                ::new ((void *)storage) stored(
+                    std::forward<callable>(function));
+                ops = &callable_operations<stored>;
+            }
+            else
+            {
+                ::new ((void *)storage) stored *(
+                    new stored(std::forward<callable>(function)));
+                ops = &heap_operations<stored>;
+            }
+        }
+    }
+
+    /**
+     *  @brief  Copy constructor.
+     *  @param  other  Other function to copy from.
+     */
+    inline constexpr inplace_function(const inplace_function &other)
+        : ops(other.ops)
+    {
+        if consteval
+        {
+            if (ops == &constant_operations)
+            {
+                constant = other.constant->clone();
+            }
+        }
+        else
+        {
+            ops->copy(storage, other.storage);
+        }
+    }
+
+    /**
+     *  @brief  Move constructor, leaves @c other empty.
+     *  @param  other  Other function to move from.
+     */
+    inline constexpr inplace_function(inplace_function &&other) noexcept
+        : ops(other.ops)
+    {
+        if consteval
+        {
+            if (ops == &constant_operations) constant = other.constant;
+        }
+        else
+        {
+            ops->move(storage, other.storage);
+        }
+        other.ops = &empty_operations;
+    }
+
+    /**
+     *  @brief  Destroys the stored callable.
+     */
+    inline constexpr ~inplace_function()
+    {
+        destroy();
+    }
+
+    /**
+     *  @brief   Copy assignment operator.
+     *
+     *  @param   other  Other function to copy from.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator= (const inplace_function &other)
+        -> inplace_function &
+    {
+        if (this == &other) return *this;
+
+        destroy();
+        ops = &empty_operations;
+        if consteval
+        {
+            if (other.ops == &constant_operations)
+            {
+                constant = other.constant->clone();
+            }
+        }
+        else
+        {
+            other.ops->copy(storage, other.storage);
+        }
+        ops = other.ops;
+        return *this;
+    }
+
+    /**
+     *  @brief   Move assignment operator, leaves @c other empty.
+     *
+     *  @param   other  Other function to move from.
+     *  @return  Reference to self.
+     */
+    inline constexpr auto operator= (inplace_function &&other) noexcept
+        -> inplace_function &
+    {
+        if (this == &other) return *this;
+
+        destroy();
+        ops = other.ops;
+        if consteval
+        {
+            if (ops == &constant_operations) constant = other.constant;
+        }
+        else
+        {
+            ops->move(storage, other.storage);
+        }
+        other.ops = &empty_operations;
+        return *this;
+    }
+
+    /**
+     *  @brief   Call the stored callable.
+     *
+     *  @param   arguments  Arguments to the callable.
+     *  @return  Return value of the callable.
+     */
+    inline constexpr auto operator() (args... arguments) const -> result
+    {
+        if consteval
+        {
+            if (ops != &constant_operations) throw std::bad_function_call();
+            return constant->invoke(std::forward<args>(arguments)...);
+        }
+        else
+        {
+            return ops->invoke(storage, std::forward<args>(arguments)...);
+        }
+    }
+
+    /**
+     *  @brief   Check whether a callable is stored.
+     *  @return  True if the function is not empty.
+     */
+    [[nodiscard]] inline constexpr explicit operator bool () const
+    {
+        return ops != &empty_operations;
+    }
+
+    /**
+     *  @brief  Destroy the stored callable.
+     */
+    inline constexpr auto destroy() -> void
+    {
+        if consteval
+        {
+            if (ops == &constant_operations) delete constant;
+        }
+        else
+        {
+            ops->destroy(storage);
+        }
+    }
+};
+
+/**
+ *  @brief   Default getter type for properties.
+ *  @tparam  type  Type to work with.
+ */
+template<typename type>
+using default_getter = inplace_function<type()>;
+
+/**
+ *  @brief   Default setter type for properties.
+ *  @tparam  type  Type to work with.
+ */
+template<typename type>
+using default_setter = inplace_function<void (const type &)>;
+
+/**
+ *  @brief   Read operators shared by all the properties.
+ *
+ *  Every operator reads the value using @c derived::get() .  Keeping the
+ *  operators in a base instead of in the property itself allows observables and
+ *  proxies to store their state directly, without closures capturing @c this .
+ *
+ *  @tparam  derived  Property type deriving from this.
+ *  @tparam  type     Type to work with.
+ */
+template<typename derived, typename type>
+struct property_readonly_operators {
+
+    /**
+     *  @brief   Get the property deriving from this.
+     *  @return  Reference to derived property.
      */
-    inline constexpr property_readonly(std::function<type()> getter)
-        : getter(getter) {}
+    [[nodiscard]] inline constexpr auto self() const -> const derived &
+    {
+        return static_cast<const derived &>(*this);
+    }
 
-    // All the below operators call getter
+    // All the below operators call derived::get()
 
     [[nodiscard]] inline constexpr operator auto () const {
-        return getter();
+        return self().get();
     }
 
     [[nodiscard]] inline constexpr auto operator+ (const type &o) const
     requires requires { std::declval<type>() + std::declval<type>(); }
     {
-        return getter() + o;
+        return self().get() + o;
     }
 
     [[nodiscard]] inline constexpr auto operator- (const type &o) const
     requires requires { std::declval<type>() - std::declval<type>(); }
     {
-        return getter() - o;
+        return self().get() - o;
     }
 
     [[nodiscard]] inline constexpr auto operator* (const type &o) const
     requires requires { std::declval<type>() * std::declval<type>(); }
     {
-        return getter() * o;
+        return self().get() * o;
     }
 
     [[nodiscard]] inline constexpr auto operator/ (const type &o) const
     requires requires { std::declval<type>() / std::declval<type>(); }
     {
-        return getter() / o;
+        return self().get() / o;
     }
 
     [[nodiscard]] inline constexpr auto operator% (const type &o) const
     requires requires { std::declval<type>() % std::declval<type>(); }
     {
-        return getter() % o;
+        return self().get() % o;
     }
 
     [[nodiscard]] inline constexpr auto operator^ (const type &o) const
     requires requires { std::declval<type>() ^ std::declval<type>(); }
     {
-        return getter() ^ o;
+        return self().get() ^ o;
     }
 
     [[nodiscard]] inline constexpr auto operator& (const type &o) const
     requires requires { std::declval<type>() & std::declval<type>(); }
     {
-        return getter() & o;
+        return self().get() & o;
     }
 
     [[nodiscard]] inline constexpr auto operator| (const type &o) const
     requires requires { std::declval<type>() | std::declval<type>(); }
     {
-        return getter() | o;
+        return self().get() | o;
     }
 
     [[nodiscard]] inline constexpr auto operator<< (const type &o) const
     requires requires { std::declval<type>() << std::declval<type>(); }
     {
-        return getter() << o;
+        return self().get() << o;
     }
 
     [[nodiscard]] inline constexpr auto operator>> (const type &o) const
     requires requires { std::declval<type>() >> std::declval<type>(); }
     {
-        return getter() >> o;
+        return self().get() >> o;
     }
 
     [[nodiscard]] inline constexpr auto operator&& (const type &o) const
     requires requires { std::declval<type>() && std::declval<type>(); }
     {
-        return getter() && o;
+        return self().get() && o;
     }
 
     [[nodiscard]] inline constexpr auto operator|| (const type &o) const
     requires requires { std::declval<type>() || std::declval<type>(); }
     {
-        return getter() || o;
+        return self().get() || o;
     }
 
     [[nodiscard]] inline constexpr auto operator~ () const
     requires requires { ~std::declval<type>(); }
     {
-        return ~getter();
+        return ~self().get();
     }
 
     [[nodiscard]] inline constexpr auto operator! () const
     requires requires { !std::declval<type>(); }
     {
-        return !getter();
+        return !self().get();
     }
 
     [[nodiscard]] inline constexpr auto operator< (const type &o) const
     requires requires { std::declval<type>() < std::declval<type>(); }
     {
-        return getter() < o;
+        return self().get() < o;
     }
 
     [[nodiscard]] inline constexpr auto operator<= (const type &o) const
     requires requires { std::declval<type>() <= std::declval<type>(); }
     {
-        return getter() <= o;
+        return self().get() <= o;
     }
 
     [[nodiscard]] inline constexpr auto operator> (const type &o) const
     requires requires { std::declval<type>() > std::declval<type>(); }
     {
-        return getter() > o;
+        return self().get() > o;
     }
 
     [[nodiscard]] inline constexpr auto operator>= (const type &o) const
     requires requires { std::declval<type>() >= std::declval<type>(); }
     {
-        return getter() >= o;
+        return self().get() >= o;
     }
 
     [[nodiscard]] inline constexpr auto operator== (const type &o) const
     requires requires { std::declval<type>() == std::declval<type>(); }
     {
-        return getter() == o;
+        return self().get() == o;
     }
 
     [[nodiscard]] inline constexpr auto operator!= (const type &o) const
     requires requires { std::declval<type>() != std::declval<type>(); }
     {
-        return getter() != o;
+        return self().get() != o;
     }
 
     template<typename ... Args>
     inline constexpr auto operator() (Args &&... args) const
-    requires requires { std::declval<type>()(std::forward<Args>(args)...); }
+    requires requires(const derived &property) {
+        property.get()(std::forward<Args>(args)...);
+    }
     {
-        return getter()(std::forward<Args>(args)...);
+        return self().get()(std::forward<Args>(args)...);
     }
 
     template<typename ... Args>
     inline constexpr auto operator[] (Args &&... args) const
-    requires requires { std::declval<type>()[std::forward<Args>(args)...]; }
+    requires requires(const derived &property) {
+        property.get()[std::forward<Args>(args)...];
+    }
     {
-        return getter()[std::forward<Args>(args)...];
+        return self().get()[std::forward<Args>(args)...];
     }
 
     [[nodiscard]] inline constexpr auto operator-> () const
-    requires requires { std::declval<type>().operator-> (); }
+    requires requires(const derived &property) {
+        property.get().operator-> ();
+    }
     {
-        return getter().operator-> ();
+        return self().get().operator-> ();
     }
 };
 
 /**
- *  @brief   Property with getter and setter.  Variable read operation will call
- *           the getter to retrieve the value, and write operation will call the
- *           setter to set the value.
- *  @tparam  type  Type to work with.
+ *  @brief   Write operators shared by all the read-write properties.
+ *
+ *  Every operator reads the value using @c derived::get() and writes the
+ *  result using @c derived::set() .
+ *
+ *  @tparam  derived  Property type deriving from this.
+ *  @tparam  type     Type to work with.
  */
-template<typename type>
-struct property : property_readonly<type> {
+template<typename derived, typename type>
+struct property_operators {
 
     /**
-     *  @brief  Setter function.
+     *  @brief   Get the property deriving from this.
+     *  @return  Reference to derived property.
      */
-    std::function<void (const type &)> setter;
+    [[nodiscard]] inline constexpr auto self() -> derived &
+    {
+        return static_cast<derived &>(*this);
+    }
 
     /**
-     *  @brief  Creates a property with provided getter and setter.
+     *  @brief   Modify the value in-place using @c operation .
      *
-     *  @param  getter  Getter function.
-     *  @param  setter  Setter function.
+     *  If the derived property has a @c modify(operation) member, the
+     *  operation is forwarded to it (e.g., to perform an atomic
+     *  read-modify-write).  Otherwise, the value is read using
+     *  @c derived::get() , modified and written using @c derived::set() .
+     *
+     *  @tparam  operation_type  Type of operation, called with @c type & .
+     *  @param   operation       Operation modifying the value.
+     *  @note    Operation may be called more than once (e.g., when atomic
+     *           update is retried), so it must only depend on its argument.
      */
-    inline constexpr property(
-        std::function<type()>              getter,
-        std::function<void (const type &)> setter
-    ) : property_readonly<type>(getter), setter(setter) {}
+    template<typename operation_type>
+    inline constexpr auto apply(operation_type &&operation) -> void
+    {
+        if constexpr (requires { self().modify(operation); })
+        {
+            self().modify(operation);
+        }
+        else
+        {
+            type value = self().get();
+            operation(value);
+            self().set(value);
+        }
+    }
 
-    // All the below operators call getter and setter
+    // All the below operators call derived::get() and derived::set(), or
+    // derived::modify() if available
 
-    inline constexpr auto operator= (const type &t) -> property &
+    inline constexpr auto operator= (const type &t) -> derived &
     requires requires(type t) { t = std::declval<type>(); }
     {
-        setter(t);
-        return *this;
+        self().set(t);
+        return self();
     }
 
-    inline constexpr auto operator+= (const type &o) -> property &
+    inline constexpr auto operator+= (const type &o) -> derived &
     requires requires(type t) { t += std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() + o);
-        return *this;
+        apply([&](type &value) { value += o; });
+        return self();
     }
 
-    inline constexpr auto operator-= (const type &o) -> property &
+    inline constexpr auto operator-= (const type &o) -> derived &
     requires requires(type t) { t -= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() - o);
-        return *this;
+        apply([&](type &value) { value -= o; });
+        return self();
     }
 
-    inline constexpr auto operator*= (const type &o) -> property &
+    inline constexpr auto operator*= (const type &o) -> derived &
     requires requires(type t) { t *= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() * o);
-        return *this;
+        apply([&](type &value) { value *= o; });
+        return self();
     }
 
-    inline constexpr auto operator/= (const type &o) -> property &
+    inline constexpr auto operator/= (const type &o) -> derived &
     requires requires(type t) { t /= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() / o);
-        return *this;
+        apply([&](type &value) { value /= o; });
+        return self();
     }
 
-    inline constexpr auto operator%= (const type &o) -> property &
+    inline constexpr auto operator%= (const type &o) -> derived &
     requires requires(type t) { t %= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() % o);
-        return *this;
+        apply([&](type &value) { value %= o; });
+        return self();
     }
 
-    inline constexpr auto operator^= (const type &o) -> property &
+    inline constexpr auto operator^= (const type &o) -> derived &
     requires requires(type t) { t ^= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() ^ o);
-        return *this;
+        apply([&](type &value) { value ^= o; });
+        return self();
     }
 
-    inline constexpr auto operator&= (const type &o) -> property &
+    inline constexpr auto operator&= (const type &o) -> derived &
     requires requires(type t) { t &= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() & o);
-        return *this;
+        apply([&](type &value) { value &= o; });
+        return self();
     }
 
-    inline constexpr auto operator|= (const type &o) -> property &
+    inline constexpr auto operator|= (const type &o) -> derived &
     requires requires(type t) { t |= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() | o);
-        return *this;
+        apply([&](type &value) { value |= o; });
+        return self();
     }
 
-    inline constexpr auto operator<<= (const type &o) -> property &
+    inline constexpr auto operator<<= (const type &o) -> derived &
     requires requires(type t) { t <<= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() << o);
-        return *this;
+        apply([&](type &value) { value <<= o; });
+        return self();
     }
 
-    inline constexpr auto operator>>= (const type &o) -> property &
+    inline constexpr auto operator>>= (const type &o) -> derived &
     requires requires(type t) { t >>= std::declval<type>(); }
     {
-        setter(property_readonly<type>::getter() >> o);
-        return *this;
+        apply([&](type &value) { value >>= o; });
+        return self();
     }
 
-    inline constexpr auto operator++ () -> property &
+    inline constexpr auto operator++ () -> derived &
     requires requires(type t) { ++t; }
     {
-        type value = property_readonly<type>::getter();
-        ++value;
-        setter(value);
-        return *this;
+        apply([&](type &value) { ++value; });
+        return self();
     }
 
     inline constexpr auto operator++ (int)
     requires requires(type t) { t++; }
     {
-        type value = property_readonly<type>::getter();
-        type copy  = value;
-        value++;
-        setter(value);
-        return copy;
+        std::optional<type> copy;
+        apply([&](type &value) {
+            copy = value;
+            value++;
+        });
+        return std::move(*copy);
     }
 
-    inline constexpr auto operator-- () -> property &
+    inline constexpr auto operator-- () -> derived &
     requires requires(type t) { --t; }
     {
-        type value = property_readonly<type>::getter();
-        --value;
-        setter(value);
-        return *this;
+        apply([&](type &value) { --value; });
+        return self();
     }
 
     inline constexpr auto operator-- (int)
     requires requires(type t) { t--; }
     {
-        type value = property_readonly<type>::getter();
-        type copy  = value;
-        value--;
-        setter(value);
-        return copy;
+        std::optional<type> copy;
+        apply([&](type &value) {
+            copy = value;
+            value--;
+        });
+        return std::move(*copy);
     }
 };
 
 /**
- *  @brief   A property with default getter and setter, and an observer that is
- *           called when the variable is changed (technically, when an operation
- *           is performed on it).
- *  @tparam  type  Type to work with.
+ *  @brief   Property with getter.  Variable read operation will call the getter
+ *           to retrieve the value.
+ *
+ *  The getter defaults to a non-allocating type-erased @c inplace_function .
+ *  When the getter type is the callable's own type (i.e., deduced using the
+ *  deduction guide), the call is inlined to the getter's body.
+ *
+ *  @tparam  type         Type to work with.
+ *  @tparam  getter_type  Getter callable type.
  */
-template<typename type>
-struct observable : property<type> {
-
-    /**
-     *  @brief  Internal value of type.
-     */
-    type value = type();
-
-    /**
-     *  @brief  Observer, called when the value is changed.
-     */
-    std::function<void (const type &)> observer;
+template<typename type, typename getter_type = default_getter<type>>
+struct property_readonly : property_readonly_operators<
+        property_readonly<type, getter_type>, type> {
 
     /**
-     *  @brief  Default constructor initializes observer to do nothing.
+     *  @brief  Getter function.
      */
-    inline constexpr observable() : property<type>([&]()
-    {
-        return this->value;
-    }, [&](const type &value)
-    {
-        this->value = value;
-        if (this->observer) this->observer(this->value);
-    }) {}
+    [[no_unique_address]] getter_type getter;
 
     /**
-     *  @brief  Creates an observable property with default value and observer.
-     *  @param  observer  Observer function.
+     *  @brief  Creates a property with provided getter.
+     *  @param  getter  Getter function.
      */
-    inline constexpr observable(
-        std::function<void (const type &)> observer
-    ) : observable()
-    {
-        this->observer = observer;
-    }
+    inline constexpr property_readonly(getter_type getter)
+        : getter(std::move(getter)) {}
 
     /**
-     *  @brief  Creates an observable property with provided value and no
-     *          observer (observer does nothing).
-     *  @param  value  Initial value.
+     *  @brief   Get the value using getter.
+     *  @return  Value returned by getter.
      */
-    inline constexpr observable(
-        type value
-    ) : observable()
+    [[nodiscard]] inline constexpr decltype(auto) get() const
     {
-        this->value = value;
+        return getter();
     }
-
-    // Explicitly inherit operator= from property due to interference with
-    // constructor
-    using property<type>::operator=;
 };
 
 /**
- *  @brief   A proxy is an observable which modifies external value instead of
- *           internally storing it.  It also has an observer that is called when
- *           an operation is performed.
+ *  @brief   Template parameter deduction guide for @c property_readonly .
+ *
+ *  Deduce type from return type of getter, and keep the getter type as is.
  *
+ *  @tparam  getter_type  Getter callable type.
+ */
+template<typename getter_type>
+property_readonly(getter_type) -> property_readonly<
+    std::remove_cvref_t<std::invoke_result_t<const getter_type &>>,
+    getter_type>;
+
+/**
+ *  @brief   In-place mutation of a value, passed to a property's modifier.
+ *  @tparam  type  Type to work with.
+ */
+template<typename type>
+using mutation = inplace_function<void (type &)>;
+
+/**
+ *  @brief   Default modifier type for properties.
  *  @tparam  type  Type to work with.
- *  @note    It cannot detect change in external value.
  */
 template<typename type>
-struct proxy : property<type> {
+using default_modifier = inplace_function<void (const mutation<type> &)>;
+
+/**
+ *  @brief  Modifier type of properties without a modifier.
+ */
+struct no_modifier {};
+
+/**
+ *  @brief   Property with getter and setter.  Variable read operation will call
+ *           the getter to retrieve the value, and write operation will call the
+ *           setter to set the value.
+ *
+ *  Compound operators (e.g., @c += , @c ++ ) read the value using getter,
+ *  modify the copy and write it back using setter.  If a modifier is provided,
+ *  they instead pass the mutation to the modifier, which applies it to the
+ *  stored value directly, without any copy:
+    ```cpp
+    std::string text;
+    prop::property property([&]() { return text; }, [&](const auto &value) {
+        text = value;
+    }, [&](const auto &mutate) {
+        mutate(text);
+    });
+    property += "appended"; // Appended in-place
+    ```
+ *
+ *  @tparam  type           Type to work with.
+ *  @tparam  getter_type    Getter callable type.
+ *  @tparam  setter_type    Setter callable type.
+ *  @tparam  modifier_type  Modifier callable type, called with a callable
+ *                          taking @c type & , or @c no_modifier .
+ */
+template<typename type, typename getter_type = default_getter<type>,
+    typename setter_type = default_setter<type>,
+    typename modifier_type = default_modifier<type>>
+struct property : property_readonly<type, getter_type>,
+    property_operators<property<type, getter_type, setter_type,
+        modifier_type>, type> {
 
     /**
-     *  @brief  External value to modify.
+     *  @brief  Base class, template arguments are long.
      */
-    type *external = nullptr;
+    using base = property_readonly<type, getter_type>;
 
     /**
-     *  @brief  Observer, called when the variable is performed on.
+     *  @brief  Setter function.
      */
-    std::function<void (const type &)> observer;
+    [[no_unique_address]] setter_type setter;
 
     /**
-     *  @brief  Creates a proxy with default value and observer.
+     *  @brief  Modifier function, optional.
      */
-    inline constexpr proxy() : property<type>([&]() {
-        if (!external) return type();
-        return *external;
-    }, [&](const type &value) {
-        if (external) *external = value;
-        if (observer) observer(value);
-    }) {}
+    [[no_unique_address]] modifier_type modifier;
 
     /**
-     *  @brief  Creates a proxy with default value and provided observer.
-     *  @param  observer  Observer function.
+     *  @brief  Creates a property with provided getter and setter, and
+     *          optionally a modifier.
+     *
+     *  @param  getter    Getter function.
+     *  @param  setter    Setter function.
+     *  @param  modifier  Modifier function (optional).
      */
-    inline constexpr proxy(
-        std::function<void (const type &)> observer
-    ) : proxy()
-    {
-        this->observer = observer;
-    }
+    inline constexpr property(
+        getter_type   getter,
+        setter_type   setter,
+        modifier_type modifier = {}
+    ) : base(std::move(getter)), setter(std::move(setter)),
+        modifier(std::move(modifier)) {}
 
     /**
-     *  @brief  Creates a proxy with provided value and no observer (observer
-     *          does nothing).
-     *  @param  value  Link to value.
+     *  @brief  Set the value using setter.
+     *  @param  value  Value to set.
      */
-    inline constexpr proxy(
-        type *value
-    ) : proxy()
+    inline constexpr auto set(const type &value) -> void
     {
-        external = value;
+        setter(value);
     }
 
     /**
-     *  @brief  Creates a proxy with provided value and observer.
-     *  @param  value    Link to value.
+     *  @brief   Modify the value using modifier, or using getter and setter if
+     *           there is no modifier.
+     *
+     *  @tparam  operation_type  Type of operation, called with @c type & .
+     *  @param   operation       Operation modifying the value.
+     */
+    template<typename operation_type>
+    inline constexpr auto modify(operation_type &&operation) -> void
+    {
+        if constexpr (!std::is_same_v<modifier_type, no_modifier>)
+        {
+            if constexpr (std::is_constructible_v<bool, modifier_type>)
+            {
+                if (static_cast<bool>(modifier))
+                {
+                    modifier(operation);
+                    return;
+                }
+            }
+            else
+            {
+                modifier(operation);
+                return;
+            }
+        }
+
+        type value = base::getter();
+        operation(value);
+        setter(value);
+    }
+
+    using property_operators<property, type>::operator=;
+};
+
+/**
+ *  @brief   Template parameter deduction guide for @c property .
+ *
+ *  Deduce type from return type of getter, and keep the getter and setter
+ *  types as is, without a modifier.
+ *
+ *  @tparam  getter_type  Getter callable type.
+ *  @tparam  setter_type  Setter callable type.
+ */
+template<typename getter_type, typename setter_type>
+property(getter_type, setter_type) -> property<
+    std::remove_cvref_t<std::invoke_result_t<const getter_type &>>,
+    getter_type, setter_type, no_modifier>;
+
+/**
+ *  @brief   Template parameter deduction guide for @c property .
+ *
+ *  Deduce type from return type of getter, and keep the getter, setter and
+ *  modifier types as is.
+ *
+ *  @tparam  getter_type    Getter callable type.
+ *  @tparam  setter_type    Setter callable type.
+ *  @tparam  modifier_type  Modifier callable type.
+ */
+template<typename getter_type, typename setter_type, typename modifier_type>
+property(getter_type, setter_type, modifier_type) -> property<
+    std::remove_cvref_t<std::invoke_result_t<const getter_type &>>,
+    getter_type, setter_type, modifier_type>;
+
+/**
+ *  @brief  Handle to a slot connected to a @c signal .
+ */
+struct connection {
+
+    /**
+     *  @brief  Index of the slot in the signal.
+     */
+    std::size_t index = (std::size_t)-1;
+
+    /**
+     *  @brief  Generation of the slot when it was connected, to detect stale
+     *          handles after the slot is reused.
+     */
+    std::size_t generation = 0;
+};
+
+/**
+ *  @brief   Signal which calls every connected slot when emitted.
+ *
+ *  Slots are stored in one contiguous slab, and disconnected slots are reused
+ *  through a free-list, so both connecting and disconnecting are O(1)
+ *  (amortized for connecting).  Each slot is an @c inplace_function , so no
+ *  allocation happens per connection once the slab has grown.
+ *
+ *  Emission is re-entrant: slots may connect, disconnect (including
+ *  themselves) or emit the signal again.  Slots connected during emission are
+ *  not called by that emission, and slots disconnected during emission are
+ *  not called after being disconnected.
+ *
+ *  Slots belong to the object owning the signal and often capture it, so they
+ *  are never copied nor moved: a copied or moved signal starts without slots,
+ *  and assigning a signal keeps its own slots.
+ *
+ *  @tparam  args  Parameter types of slots.
+ */
+template<typename ... args>
+struct signal {
+
+    /**
+     *  @brief  Type of slot function.
+     */
+    using slot_function = inplace_function<void (args...)>;
+
+    /**
+     *  @brief  Slot in the slab.
+     */
+    struct slot {
+
+        /**
+         *  @brief  Slot function, empty if the slot is free.
+         */
+        slot_function function;
+
+        /**
+         *  @brief  Incremented every time the slot is freed.
+         */
+        std::size_t generation = 0;
+
+        /**
+         *  @brief  Next free slot index if this slot is free.
+         */
+        std::size_t next_free = (std::size_t)-1;
+
+        /**
+         *  @brief  Whether the slot is connected.
+         */
+        bool connected = false;
+    };
+
+    /**
+     *  @brief  Slab of slots.
+     */
+    std::vector<slot> slots;
+
+    /**
+     *  @brief  Slots connected during emission, appended to @c slots after
+     *          emission to keep the slots being called in place.
+     */
+    std::vector<slot> pending;
+
+    /**
+     *  @brief  First free slot index.
+     */
+    std::size_t free_head = (std::size_t)-1;
+
+    /**
+     *  @brief  Number of slots disconnected during emission, freed after
+     *          emission.
+     */
+    std::size_t released = 0;
+
+    /**
+     *  @brief  Number of nested emissions in progress.
+     */
+    std::size_t emitting = 0;
+
+    /**
+     *  @brief  Object holding a pointer to the signal, told when the signal is
+     *          destroyed.
+     */
+    struct dependent {
+
+        /**
+         *  @brief  Object holding the pointer.
+         */
+        void *object = nullptr;
+
+        /**
+         *  @brief  Tell @c object that @c source is being destroyed.
+         */
+        void (*forget)(void *object, signal *source) = nullptr;
+    };
+
+    /**
+     *  @brief  Objects holding a pointer to the signal, neither copied nor
+     *          moved along with the slots.
+     */
+    std::vector<dependent> dependents;
+
+    /**
+     *  @brief  Creates a signal without slots.
+     */
+    inline signal() = default;
+
+    /**
+     *  @brief  Creates a signal without slots, slots are not copied.
+     */
+    inline signal(const signal &) {}
+
+    /**
+     *  @brief  Creates a signal without slots, the other signal keeps its
+     *          slots.
+     */
+    inline signal(signal &&) noexcept {}
+
+    /**
+     *  @brief  Tells the dependents that the signal is destroyed.
+     */
+    inline ~signal()
+    {
+        // Dependents forgetting the signal must not touch the list in use
+        auto forgetting = std::move(dependents);
+        for (auto &held : forgetting) held.forget(held.object, this);
+    }
+
+    /**
+     *  @brief   Keep the slots, slots are not copied.
+     *  @return  Reference to self.
+     */
+    inline auto operator= (const signal &) -> signal &
+    {
+        return *this;
+    }
+
+    /**
+     *  @brief   Keep the slots, the other signal keeps its slots.
+     *  @return  Reference to self.
+     */
+    inline auto operator= (signal &&) noexcept -> signal &
+    {
+        return *this;
+    }
+
+    /**
+     *  @brief   Connect a slot function.
+     *
+     *  @param   function  Slot function.
+     *  @return  Handle to disconnect the slot.
+     */
+    inline auto connect(slot_function function) -> connection
+    {
+        ALCELIN_COUNT_ALLOCS("prop::signal::connect");
+
+        // Keep the slots vector untouched while slots are being called
+        if (emitting)
+        {
+            pending.emplace_back(slot { std::move(function), 0,
+                (std::size_t)-1, true });
+            return connection { slots.size() + pending.size() - 1, 0 };
+        }
+
+        if (free_head == (std::size_t)-1)
+        {
+            slots.emplace_back(slot { std::move(function), 0,
+                (std::size_t)-1, true });
+            return connection { slots.size() - 1, 0 };
+        }
+
+        std::size_t index = free_head;
+        auto       &free  = slots[index];
+        free_head      = free.next_free;
+        free.function  = std::move(function);
+        free.connected = true;
+        return connection { index, free.generation };
+    }
+
+    /**
+     *  @brief   Disconnect a slot.  Stale or invalid handles are ignored.
+     *
+     *  @param   handle  Handle returned by @c connect .
+     *  @return  True if the slot was connected.
+     */
+    inline auto disconnect(connection handle) -> bool
+    {
+        if (handle.index >= slots.size())
+        {
+            std::size_t index = handle.index - slots.size();
+            if (index >= pending.size() || !pending[index].connected)
+            {
+                return false;
+            }
+            pending[index].connected = false;
+            return true;
+        }
+
+        auto &connected = slots[handle.index];
+        if (!connected.connected || connected.generation != handle.generation)
+        {
+            return false;
+        }
+        connected.connected = false;
+
+        // The slot may be the one being called, keep it alive until emission
+        // is over
+        if (emitting) released++;
+        else free_slot(handle.index);
+        return true;
+    }
+
+    /**
+     *  @brief   Check whether a slot is still connected.
+     *
+     *  @param   handle  Handle returned by @c connect .
+     *  @return  True if the slot is connected.
+     */
+    [[nodiscard]] inline auto is_connected(connection handle) const -> bool
+    {
+        if (handle.index >= slots.size())
+        {
+            std::size_t index = handle.index - slots.size();
+            return index < pending.size() && pending[index].connected;
+        }
+        return slots[handle.index].connected
+            && slots[handle.index].generation == handle.generation;
+    }
+
+    /**
+     *  @brief   Get the number of connected slots.
+     *  @return  Number of connected slots.
+     */
+    [[nodiscard]] inline auto size() const -> std::size_t
+    {
+        auto is_connected = [&](const slot &slot) {
+            return slot.connected;
+        };
+        return std::ranges::count_if(slots, is_connected)
+             + std::ranges::count_if(pending, is_connected);
+    }
+
+    /**
+     *  @brief  Call every connected slot.
+     *  @param  arguments  Arguments to slots.
+     */
+    inline auto emit(args... arguments) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::signal::emit");
+
+        if (slots.empty()) return;
+
+        // Finish emission even if a slot throws
+        struct emission {
+            signal *emitted = nullptr;
+
+            inline ~emission()
+            {
+                if (--emitted->emitting == 0) emitted->flush();
+            }
+        } guard = { this };
+
+        emitting++;
+
+        // Index-based, slots connected during emission go to pending
+        std::size_t count = slots.size();
+        for (std::size_t i = 0; i < count; i++)
+        {
+            if (slots[i].connected) slots[i].function(arguments...);
+        }
+    }
+
+    /**
+     *  @brief  Call every connected slot.
+     *  @param  arguments  Arguments to slots.
+     */
+    inline auto operator() (args... arguments) -> void
+    {
+        emit(arguments...);
+    }
+
+    /**
+     *  @brief  Free a slot and push it to the free-list.
+     *  @param  index  Slot index.
+     */
+    inline auto free_slot(std::size_t index) -> void
+    {
+        auto &freed = slots[index];
+        freed.function  = nullptr;
+        freed.connected = false;
+        freed.generation++;
+        freed.next_free = free_head;
+        free_head       = index;
+    }
+
+    /**
+     *  @brief  Apply connections and disconnections made during emission.
+     */
+    inline auto flush() -> void
+    {
+        if (released)
+        {
+            for (std::size_t i = 0; i < slots.size(); i++)
+            {
+                // Free slots have an empty function
+                if (!slots[i].connected && slots[i].function) free_slot(i);
+            }
+            released = 0;
+        }
+
+        // Pending slots keep their index as their handle was given out
+        for (auto &connected : pending)
+        {
+            slots.emplace_back(std::move(connected));
+            if (!slots.back().connected) free_slot(slots.size() - 1);
+        }
+        pending.clear();
+    }
+};
+
+/**
+ *  @brief  Scope which defers notifications of observables and proxies until
+ *          the outermost batch ends.
+ *
+ *  While a batch is alive (on the current thread), setting an observable only
+ *  changes its value and remembers the value before the batch.  When the
+ *  outermost batch is destroyed, every changed observable is notified once,
+ *  with its final value.  Observables whose final value equals the value
+ *  before the batch are not notified at all.
+ *
+ *  For example:
+    ```cpp
+    {
+        prop::batch batch;
+        for (auto &observable : observables) observable += 1;
+    } // Each observable is notified here, once
+    ```
+ *
+ *  @warning  Do not destroy or move an observable with a deferred notification
+ *            before the batch ends.
+ */
+struct batch {
+
+    /**
+     *  @brief  Number of nested batches alive on this thread.
+     */
+    static inline thread_local std::size_t depth = 0;
+
+    /**
+     *  @brief  Deferred notifications, in the order of first change.
+     */
+    static inline thread_local std::vector<inplace_function<void ()>> pending;
+
+    /**
+     *  @brief  Begins a batch.
+     */
+    inline batch()
+    {
+        depth++;
+    }
+
+    batch(const batch &) = delete;
+
+    /**
+     *  @brief  Ends the batch, and delivers deferred notifications if this is
+     *          the outermost batch.
+     */
+    inline ~batch()
+    {
+        if (--depth == 0) flush();
+    }
+
+    /**
+     *  @brief   Check whether a batch is alive on this thread.
+     *  @return  True if notifications are to be deferred.
+     */
+    [[nodiscard]] static inline auto active() -> bool
+    {
+        return depth != 0;
+    }
+
+    /**
+     *  @brief  Defer a notification until the outermost batch ends.
+     *  @param  deliver  Function delivering the notification.
+     */
+    static inline auto defer(inplace_function<void ()> deliver) -> void
+    {
+        pending.emplace_back(std::move(deliver));
+    }
+
+    /**
+     *  @brief  Deliver every deferred notification.
+     */
+    static inline auto flush() -> void
+    {
+        // Notifications may defer more notifications by starting a new batch
+        std::vector<inplace_function<void ()>> delivering;
+        while (!pending.empty())
+        {
+            delivering.swap(pending);
+            for (auto &deliver : delivering) deliver();
+            delivering.clear();
+        }
+
+        // Keep the capacity for the next batch
+        pending.swap(delivering);
+    }
+
+    auto operator= (const batch &) -> batch & = delete;
+};
+
+/**
+ *  @brief  Dependency tracking and memoization shared by computed properties.
+ *
+ *  While a computed property evaluates, it is the current tracker of the
+ *  thread.  Every observable, proxy or computed property read during the
+ *  evaluation connects its @c invalidated signal to the tracker.  When any of
+ *  them changes, the tracker is marked dirty, which marks its own dependents
+ *  dirty, and so on.  Nothing is recomputed until the value is read, and
+ *  reading a dirty computed property first recomputes the dirty computed
+ *  properties it reads, so recomputation happens in topological order.
+ *
+ *  When a dependency is destroyed, for example when a @c std::vector of
+ *  observables reallocates, the computed property forgets it and becomes
+ *  dirty, and the next evaluation tracks whatever it reads then.
+ *
+ *  @warning  Computed properties are nodes in a graph of pointers and cannot be
+ *            copied or moved.
+ */
+struct computed_base {
+
+    /**
+     *  @brief  Computed property being evaluated on this thread, if any.
+     */
+    static inline thread_local computed_base *current = nullptr;
+
+    /**
+     *  @brief  Signal emitted when the computed property becomes dirty.
+     */
+    signal<> invalidated;
+
+    /**
+     *  @brief  Signals of dependencies read during last evaluation.
+     */
+    std::vector<signal<> *> sources;
+
+    /**
+     *  @brief  Connections to signals of dependencies, parallel to
+     *          @c sources .
+     */
+    std::vector<connection> connections;
+
+    /**
+     *  @brief  Whether the cached value is outdated.
+     */
+    bool dirty = true;
+
+    /**
+     *  @brief  Number of reads served from cache.
+     */
+    std::size_t hits = 0;
+
+    /**
+     *  @brief  Number of reads which recomputed the value.
+     */
+    std::size_t misses = 0;
+
+    /**
+     *  @brief  Creates a dirty computed property without dependencies.
+     */
+    inline computed_base() = default;
+
+    computed_base(const computed_base &) = delete;
+
+    /**
+     *  @brief  Disconnects from all the dependencies.
+     */
+    inline ~computed_base()
+    {
+        untrack();
+    }
+
+    /**
+     *  @brief   Track @c source as a dependency of the computed property being
+     *           evaluated on this thread, if any.
+     *
+     *  @param   source  Signal emitted when the dependency changes.
+     */
+    static inline auto track_read(const signal<> &source) -> void
+    {
+        // Connecting to a signal does not modify the dependency's value
+        if (current) current->track(const_cast<signal<> &>(source));
+    }
+
+    /**
+     *  @brief  Add @c source as a dependency, once.
+     *  @param  source  Signal emitted when the dependency changes.
+     */
+    inline auto track(signal<> &source) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::computed_base::track");
+
+        if (std::ranges::find(sources, &source) != sources.end()) return;
+
+        sources.emplace_back(&source);
+        connections.emplace_back(source.connect([&]() { invalidate(); }));
+        source.dependents.push_back({ this, &forget });
+    }
+
+    /**
+     *  @brief  Disconnect from all the dependencies.
+     */
+    inline auto untrack() -> void
+    {
+        for (std::size_t i = 0; i < sources.size(); i++)
+        {
+            sources[i]->disconnect(connections[i]);
+            std::erase_if(sources[i]->dependents, [&](const auto &held) {
+                return held.object == this;
+            });
+        }
+        sources.clear();
+        connections.clear();
+    }
+
+    /**
+     *  @brief  Forget a dependency being destroyed, and mark dirty.
+     *
+     *  @param  object  Computed property tracking @c source .
+     *  @param  source  Signal of the dependency being destroyed.
+     */
+    static inline auto forget(void *object, signal<> *source) -> void
+    {
+        auto tracker = (computed_base *)object;
+        auto it      = std::ranges::find(tracker->sources, source);
+        if (it == tracker->sources.end()) return;
+
+        auto index = it - tracker->sources.begin();
+        tracker->sources.erase(it);
+        tracker->connections.erase(tracker->connections.begin() + index);
+        tracker->invalidate();
+    }
+
+    /**
+     *  @brief  Mark dirty and propagate to dependents, unless already dirty.
+     */
+    inline auto invalidate() -> void
+    {
+        if (dirty) return;
+
+        dirty = true;
+        invalidated.emit();
+    }
+
+    auto operator= (const computed_base &) -> computed_base & = delete;
+};
+
+/**
+ *  @brief   Read-only property whose value is computed from other properties,
+ *           and cached until any of them changes.
+ *
+ *  Dependencies are recorded automatically: every observable, proxy or other
+ *  computed property read by the function is a dependency.
+ *
+ *  For example:
+    ```cpp
+    prop::observable<int> width = 2, height = 3;
+    prop::computed area([&]() { return width * height; });
+
+    int a = area; // Computed
+    int b = area; // Cached
+    width = 4;    // Marks area dirty
+    int c = area; // Computed
+    ```
+ *
+ *  @tparam  type           Type to work with.
+ *  @tparam  function_type  Function type computing the value.
+ */
+template<typename type, typename function_type = default_getter<type>>
+struct computed : computed_base,
+    property_readonly_operators<computed<type, function_type>, type> {
+
+    /**
+     *  @brief  Function computing the value.
+     */
+    [[no_unique_address]] function_type function;
+
+    /**
+     *  @brief  Cached value.
+     */
+    std::optional<type> cache;
+
+    /**
+     *  @brief  Creates a computed property with provided function.  The value
+     *          is computed on first read.
+     *
+     *  @param  function  Function computing the value.
+     */
+    inline computed(function_type function) : function(std::move(function)) {}
+
+    /**
+     *  @brief   Get the cached value, recomputing it first if dirty.
+     *  @return  Reference to cached value.
+     */
+    [[nodiscard]] inline auto get() const -> const type &
+    {
+        // Caching is not an observable modification
+        return const_cast<computed *>(this)->evaluate();
+    }
+
+    /**
+     *  @brief   Get the cached value, recomputing it first if dirty.
+     *  @return  Reference to cached value.
+     */
+    inline auto evaluate() -> const type &
+    {
+        track_read(invalidated);
+
+        if (!dirty)
+        {
+            hits++;
+            return *cache;
+        }
+        misses++;
+
+        // Dependencies may differ between evaluations
+        untrack();
+
+        struct evaluation {
+            computed_base *previous = nullptr;
+
+            inline ~evaluation()
+            {
+                current = previous;
+            }
+        } guard = { current };
+
+        current = this;
+        cache   = function();
+        dirty   = false;
+        return *cache;
+    }
+};
+
+/**
+ *  @brief   Template parameter deduction guide for @c computed .
+ *
+ *  Deduce type from return type of function, and keep the function type as
+ *  is.
+ *
+ *  @tparam  function_type  Function type computing the value.
+ */
+template<typename function_type>
+computed(function_type) -> computed<
+    std::remove_cvref_t<std::invoke_result_t<const function_type &>>,
+    function_type>;
+
+/**
+ *  @brief   A property with internal value, and an observer that is called
+ *           when the variable is changed (technically, when an operation is
+ *           performed on it).
+ *
+ *  The value is stored directly in the observable, so it can be copied and
+ *  moved by value (e.g., stored in a @c std::vector ).  Copies share nothing
+ *  with the original except a copy of the observer, and start without any
+ *  slot connected to their signals.
+ *
+ *  @tparam  type  Type to work with.
+ */
+template<typename type>
+struct observable : property_readonly_operators<observable<type>, type>,
+    property_operators<observable<type>, type> {
+
+    /**
+     *  @brief  Internal value of type.
+     */
+    type value = type();
+
+    /**
+     *  @brief  Observer, called when the value is changed.
+     */
+    std::function<void (const type &)> observer;
+
+    /**
+     *  @brief  Signal emitted after the observer, for any number of
+     *          subscribers.
+     */
+    signal<const type &> changed;
+
+    /**
+     *  @brief  Signal emitted after @c changed , with old and new value.
+     */
+    signal<const type &, const type &> transitioned;
+
+    /**
+     *  @brief  Signal emitted before any notification, and immediately even in
+     *          a @c batch , to invalidate dependent computed properties.
+     */
+    signal<> invalidated;
+
+    /**
+     *  @brief  Value before the current batch, set while a notification is
+     *          deferred by @c batch .
+     */
+    std::optional<type> deferred_old;
+
+    /**
+     *  @brief  Skip the notification if the new value equals the old value.
+     */
+    bool skip_unchanged = false;
+
+    /**
+     *  @brief  Default constructor initializes observer to do nothing.
+     */
+    inline constexpr observable() = default;
+
+    /**
+     *  @brief  Creates an observable property with default value and observer.
+     *  @param  observer  Observer function.
+     */
+    inline constexpr observable(
+        std::function<void (const type &)> observer
+    ) : observer(std::move(observer)) {}
+
+    /**
+     *  @brief  Creates an observable property with provided value and no
+     *          observer (observer does nothing).
+     *  @param  value  Initial value.
+     */
+    inline constexpr observable(
+        type value
+    ) : value(std::move(value)) {}
+
+    /**
+     *  @brief   Get the internal value.
+     *  @return  Reference to internal value.
+     */
+    [[nodiscard]] inline constexpr auto get() const -> const type &
+    {
+        computed_base::track_read(invalidated);
+        return value;
+    }
+
+    /**
+     *  @brief  Set the internal value and call the observer, or defer the
+     *          notification if a @c batch is alive.
+     *
+     *  @param  value  Value to set.
+     */
+    inline constexpr auto set(const type &value) -> void
+    {
+        if (batch::active())
+        {
+            if (!deferred_old)
+            {
+                deferred_old = this->value;
+                batch::defer([&]() { deliver(); });
+            }
+            this->value = value;
+            invalidated.emit();
+            return;
+        }
+
+        if constexpr (std::equality_comparable<type>)
+        {
+            if (skip_unchanged && this->value == value) return;
+        }
+
+        // Only keep the old value if someone wants it
+        if (transitioned.slots.empty())
+        {
+            this->value = value;
+            notify();
+            return;
+        }
+
+        // The value may alias the stored value, copy it before moving out
+        type next = value;
+        type old  = std::exchange(this->value, std::move(next));
+        notify();
+        transitioned.emit(old, this->value);
+    }
+
+    /**
+     *  @brief   Modify the internal value in-place and notify once, or defer
+     *           the notification if a @c batch is alive.
+     *
+     *  @tparam  operation_type  Type of operation, called with @c type & .
+     *  @param   operation       Operation modifying the value.
+     */
+    template<typename operation_type>
+    inline constexpr auto modify(operation_type &&operation) -> void
+    {
+        if (batch::active())
+        {
+            if (!deferred_old)
+            {
+                deferred_old = this->value;
+                batch::defer([&]() { deliver(); });
+            }
+            operation(this->value);
+            invalidated.emit();
+            return;
+        }
+
+        // Only copy the old value if someone wants it
+        if (!skip_unchanged && transitioned.slots.empty())
+        {
+            operation(this->value);
+            notify();
+            return;
+        }
+
+        type old = this->value;
+        operation(this->value);
+
+        if constexpr (std::equality_comparable<type>)
+        {
+            if (skip_unchanged && old == this->value) return;
+        }
+
+        notify();
+        transitioned.emit(old, this->value);
+    }
+
+    /**
+     *  @brief  Call the observer and emit @c changed .
+     */
+    inline constexpr auto notify() -> void
+    {
+        invalidated.emit();
+        if (observer) observer(this->value);
+        changed.emit(this->value);
+    }
+
+    /**
+     *  @brief  Deliver the notification deferred by @c batch .
+     */
+    inline constexpr auto deliver() -> void
+    {
+        type old = std::move(*deferred_old);
+        deferred_old.reset();
+
+        if constexpr (std::equality_comparable<type>)
+        {
+            if (old == this->value) return;
+        }
+
+        notify();
+        transitioned.emit(old, this->value);
+    }
+
+    // Explicitly inherit operator= from property operators due to interference
+    // with constructor
+    using property_operators<observable, type>::operator=;
+};
+
+/**
+ *  @brief   A proxy is an observable which modifies external value instead of
+ *           internally storing it.  It also has an observer that is called when
+ *           an operation is performed.
+ *
+ *  The proxy only stores a pointer to the external value, so it can be copied
+ *  and moved by value.  Copies control the same external value, and start
+ *  without any slot connected to their signals.
+ *
+ *  @tparam  type  Type to work with.
+ *  @note    It cannot detect change in external value.
+ */
+template<typename type>
+struct proxy : property_readonly_operators<proxy<type>, type>,
+    property_operators<proxy<type>, type> {
+
+    /**
+     *  @brief  External value to modify.
+     */
+    type *external = nullptr;
+
+    /**
+     *  @brief  Observer, called when the variable is performed on.
+     */
+    std::function<void (const type &)> observer;
+
+    /**
+     *  @brief  Signal emitted after the observer, for any number of
+     *          subscribers.
+     */
+    signal<const type &> changed;
+
+    /**
+     *  @brief  Signal emitted after @c changed , with old and new value.
+     */
+    signal<const type &, const type &> transitioned;
+
+    /**
+     *  @brief  Signal emitted before any notification, and immediately even in
+     *          a @c batch , to invalidate dependent computed properties.
+     */
+    signal<> invalidated;
+
+    /**
+     *  @brief  External value before the current batch, set while a
+     *          notification is deferred by @c batch .
+     */
+    std::optional<type> deferred_old;
+
+    /**
+     *  @brief  Skip the notification if the new value equals the old value.
+     */
+    bool skip_unchanged = false;
+
+    /**
+     *  @brief  Creates a proxy with default value and observer.
+     */
+    inline constexpr proxy() = default;
+
+    /**
+     *  @brief  Creates a proxy with default value and provided observer.
+     *  @param  observer  Observer function.
+     */
+    inline constexpr proxy(
+        std::function<void (const type &)> observer
+    ) : observer(std::move(observer)) {}
+
+    /**
+     *  @brief  Creates a proxy with provided value and no observer (observer
+     *          does nothing).
+     *  @param  value  Link to value.
+     */
+    inline constexpr proxy(
+        type *value
+    ) : external(value) {}
+
+    /**
+     *  @brief  Creates a proxy with provided value and observer.
+     *  @param  value    Link to value.
      *  @param  observer Observer function.
      */
-    inline constexpr proxy(
-        type                              *value,
-        std::function<void (const type &)> observer
-    ) : proxy()
+    inline constexpr proxy(
+        type                              *value,
+        std::function<void (const type &)> observer
+    ) : external(value), observer(std::move(observer)) {}
+
+    /**
+     *  @brief   Get the external value.
+     *  @return  Copy of external value, or default constructed value if no
+     *           external value is linked.
+     */
+    [[nodiscard]] inline constexpr auto get() const -> type
+    {
+        computed_base::track_read(invalidated);
+        if (!external) return type();
+        return *external;
+    }
+
+    /**
+     *  @brief  Set the external value and call the observer, or defer the
+     *          notification if a @c batch is alive.
+     *
+     *  @param  value  Value to set.
+     */
+    inline constexpr auto set(const type &value) -> void
+    {
+        if (batch::active())
+        {
+            if (!deferred_old)
+            {
+                deferred_old = get();
+                batch::defer([&]() { deliver(); });
+            }
+            if (external) *external = value;
+            invalidated.emit();
+            return;
+        }
+
+        if constexpr (std::equality_comparable<type>)
+        {
+            if (skip_unchanged && get() == value) return;
+        }
+
+        if (transitioned.slots.empty())
+        {
+            if (external) *external = value;
+            notify(value);
+            return;
+        }
+
+        type old = get();
+        if (external) *external = value;
+        notify(value);
+        transitioned.emit(old, value);
+    }
+
+    /**
+     *  @brief   Modify the external value in-place and notify once, or defer
+     *           the notification if a @c batch is alive.
+     *
+     *  @tparam  operation_type  Type of operation, called with @c type & .
+     *  @param   operation       Operation modifying the value.
+     */
+    template<typename operation_type>
+    inline constexpr auto modify(operation_type &&operation) -> void
+    {
+        // Nothing to modify in-place, notify with the modified default value
+        if (!external)
+        {
+            type value = type();
+            operation(value);
+            set(value);
+            return;
+        }
+
+        if (batch::active())
+        {
+            if (!deferred_old)
+            {
+                deferred_old = *external;
+                batch::defer([&]() { deliver(); });
+            }
+            operation(*external);
+            invalidated.emit();
+            return;
+        }
+
+        if (!skip_unchanged && transitioned.slots.empty())
+        {
+            operation(*external);
+            notify(*external);
+            return;
+        }
+
+        type old = *external;
+        operation(*external);
+
+        if constexpr (std::equality_comparable<type>)
+        {
+            if (skip_unchanged && old == *external) return;
+        }
+
+        notify(*external);
+        transitioned.emit(old, *external);
+    }
+
+    /**
+     *  @brief  Call the observer and emit @c changed .
+     *  @param  value  Value that was set.
+     */
+    inline constexpr auto notify(const type &value) -> void
+    {
+        invalidated.emit();
+        if (observer) observer(value);
+        changed.emit(value);
+    }
+
+    /**
+     *  @brief  Deliver the notification deferred by @c batch .
+     */
+    inline constexpr auto deliver() -> void
+    {
+        type old = std::move(*deferred_old);
+        deferred_old.reset();
+
+        type value = get();
+        if constexpr (std::equality_comparable<type>)
+        {
+            if (old == value) return;
+        }
+
+        notify(value);
+        transitioned.emit(old, value);
+    }
+
+    // Explicitly inherit operator= from property operators due to interference
+    // with constructor
+    using property_operators<proxy, type>::operator=;
+};
+
+/**
+ *  @brief  Kind of change in an observable container.
+ */
+enum class change_kind {
+    unknown = -1,
+    insert, // Elements were inserted
+    erase,  // Elements were erased
+    update, // Elements were modified in-place
+    clear,  // All the elements were erased
+    max
+};
+
+/**
+ *  @brief   Convert change kind to string.
+ *
+ *  @param   kind  Change kind.
+ *  @return  String representation of change kind.
+ */
+[[nodiscard]] inline constexpr auto to_string(change_kind kind)
+{
+    using namespace std::string_literals;
+    switch (kind)
+    {
+        case change_kind::unknown: return "unknown"s;
+        case change_kind::insert: return "insert"s;
+        case change_kind::erase: return "erase"s;
+        case change_kind::update: return "update"s;
+        case change_kind::clear: return "clear"s;
+        case change_kind::max: return "max"s;
+    }
+    return ""s;
+}
+
+/**
+ *  @brief  Change in an @c observable_vector , as a range of indices.
+ *
+ *  For @c change_kind::insert , the range is the inserted elements (after
+ *  insertion).  For @c change_kind::erase , the range is the erased elements
+ *  (before erasure).  For @c change_kind::clear , the range is every element
+ *  before clearing.
+ */
+struct vector_change {
+
+    /**
+     *  @brief  Kind of change.
+     */
+    change_kind kind = change_kind::unknown;
+
+    /**
+     *  @brief  Index of first changed element.
+     */
+    std::size_t first = 0;
+
+    /**
+     *  @brief  Number of changed elements.
+     */
+    std::size_t count = 0;
+};
+
+/**
+ *  @brief   Vector which emits a compact change event for every modification,
+ *           instead of copying the whole vector like @c observable does.
+ *
+ *  Reads are const, modifications go through member functions which modify
+ *  the vector in-place and emit one @c vector_change each.
+ *
+ *  @tparam  element_type  Type of element.
+ *  @tparam  alloc         Allocator type.
+ */
+template<typename element_type, typename alloc = std::allocator<element_type>>
+struct observable_vector {
+
+    /**
+     *  @brief  Underlying vector, do not modify it directly.
+     */
+    std::vector<element_type, alloc> values;
+
+    /**
+     *  @brief  Signal emitted after every modification.
+     */
+    signal<const vector_change &> changed;
+
+    /**
+     *  @brief  Signal emitted before @c changed , to invalidate dependent
+     *          computed properties.
+     */
+    signal<> invalidated;
+
+    /**
+     *  @brief  Creates an empty vector.
+     */
+    inline observable_vector() = default;
+
+    /**
+     *  @brief  Creates a vector from an initializer list.
+     *  @param  list  An @c std::initializer_list .
+     */
+    inline observable_vector(std::initializer_list<element_type> list)
+        : values(list) {}
+
+    /**
+     *  @brief   Get the underlying vector.
+     *  @return  Constant reference to underlying vector.
+     */
+    [[nodiscard]] inline auto get() const
+    -> const std::vector<element_type, alloc> &
+    {
+        computed_base::track_read(invalidated);
+        return values;
+    }
+
+    /**
+     *  @brief   Get the number of elements.
+     *  @return  Number of elements.
+     */
+    [[nodiscard]] inline auto size() const -> std::size_t
+    {
+        return get().size();
+    }
+
+    /**
+     *  @brief   Check whether the vector is empty.
+     *  @return  True if there are no elements.
+     */
+    [[nodiscard]] inline auto empty() const -> bool
+    {
+        return get().empty();
+    }
+
+    /**
+     *  @brief   Get iterator to the first element.
+     *  @return  Constant iterator.
+     */
+    [[nodiscard]] inline auto begin() const
+    {
+        return get().begin();
+    }
+
+    /**
+     *  @brief   Get iterator past the last element.
+     *  @return  Constant iterator.
+     */
+    [[nodiscard]] inline auto end() const
+    {
+        return get().end();
+    }
+
+    /**
+     *  @brief  Insert elements and notify.
+     *
+     *  @param  index  Index to insert at.
+     *  @param  first  Iterator to first element to insert.
+     *  @param  last   Iterator past last element to insert.
+     */
+    template<std::input_iterator iterator>
+    inline auto insert(
+        std::size_t index,
+        iterator    first,
+        iterator    last
+    ) -> void
+    {
+        std::size_t size = values.size();
+        values.insert(values.begin() + index, first, last);
+        notify({ change_kind::insert, index, values.size() - size });
+    }
+
+    /**
+     *  @brief  Insert an element and notify.
+     *
+     *  @param  index  Index to insert at.
+     *  @param  value  Element to insert.
+     */
+    inline auto insert(std::size_t index, element_type value) -> void
+    {
+        values.insert(values.begin() + index, std::move(value));
+        notify({ change_kind::insert, index, 1 });
+    }
+
+    /**
+     *  @brief  Append an element and notify.
+     *  @param  value  Element to append.
+     */
+    inline auto push_back(element_type value) -> void
+    {
+        values.push_back(std::move(value));
+        notify({ change_kind::insert, values.size() - 1, 1 });
+    }
+
+    /**
+     *  @brief   Construct an element at the end and notify.
+     *
+     *  @tparam  args       Types of constructor arguments.
+     *  @param   arguments  Constructor arguments.
+     */
+    template<typename ... args>
+    inline auto emplace_back(args &&... arguments) -> void
+    {
+        values.emplace_back(std::forward<args>(arguments)...);
+        notify({ change_kind::insert, values.size() - 1, 1 });
+    }
+
+    /**
+     *  @brief  Erase elements and notify.
+     *
+     *  @param  first  Index of first element to erase.
+     *  @param  last   Index past last element to erase.
+     */
+    inline auto erase(std::size_t first, std::size_t last) -> void
+    {
+        if (first >= last) return;
+
+        values.erase(values.begin() + first, values.begin() + last);
+        notify({ change_kind::erase, first, last - first });
+    }
+
+    /**
+     *  @brief  Erase an element and notify.
+     *  @param  index  Index of element to erase.
+     */
+    inline auto erase(std::size_t index) -> void
+    {
+        erase(index, index + 1);
+    }
+
+    /**
+     *  @brief  Erase the last element and notify.
+     */
+    inline auto pop_back() -> void
+    {
+        erase(values.size() - 1);
+    }
+
+    /**
+     *  @brief  Erase all the elements and notify.
+     */
+    inline auto clear() -> void
+    {
+        std::size_t size = values.size();
+        values.clear();
+        notify({ change_kind::clear, 0, size });
+    }
+
+    /**
+     *  @brief  Replace an element and notify.
+     *
+     *  @param  index  Index of element to replace.
+     *  @param  value  New element.
+     */
+    inline auto set(std::size_t index, element_type value) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::observable_vector::set");
+
+        values[index] = std::move(value);
+        notify({ change_kind::update, index, 1 });
+    }
+
+    /**
+     *  @brief   Modify elements in-place and notify once.
+     *
+     *  @tparam  operation_type  Type of operation, called with
+     *                           @c element_type & .
+     *  @param   first           Index of first element to modify.
+     *  @param   last            Index past last element to modify.
+     *  @param   operation       Operation modifying each element.
+     */
+    template<typename operation_type>
+    inline auto modify(
+        std::size_t      first,
+        std::size_t      last,
+        operation_type &&operation
+    ) -> void
+    {
+        if (first >= last) return;
+
+        for (std::size_t i = first; i < last; i++) operation(values[i]);
+        notify({ change_kind::update, first, last - first });
+    }
+
+    /**
+     *  @brief   Modify an element in-place and notify.
+     *
+     *  @tparam  operation_type  Type of operation, called with
+     *                           @c element_type & .
+     *  @param   index           Index of element to modify.
+     *  @param   operation       Operation modifying the element.
+     */
+    template<typename operation_type>
+    inline auto modify(std::size_t index, operation_type &&operation) -> void
+    {
+        modify(index, index + 1, std::forward<operation_type>(operation));
+    }
+
+    /**
+     *  @brief  Emit the change.
+     *  @param  change  Change to emit.
+     */
+    inline auto notify(const vector_change &change) -> void
+    {
+        invalidated.emit();
+        changed.emit(change);
+    }
+
+    /**
+     *  @brief   Get an element.
+     *
+     *  @param   index  Index of element.
+     *  @return  Constant reference to element.
+     */
+    [[nodiscard]] inline auto operator[] (std::size_t index) const
+    -> const element_type &
+    {
+        return get()[index];
+    }
+};
+
+/**
+ *  @brief   Change in an @c observable_map .
+ *
+ *  @tparam  key_type  Type of key.
+ *  @note    @c key points to the changed key and is only valid during the
+ *           emission.  It is null for @c change_kind::clear .
+ */
+template<typename key_type>
+struct map_change {
+
+    /**
+     *  @brief  Kind of change.
+     */
+    change_kind kind = change_kind::unknown;
+
+    /**
+     *  @brief  Changed key.
+     */
+    const key_type *key = nullptr;
+};
+
+/**
+ *  @brief   Map which emits a compact change event for every modification,
+ *           instead of copying the whole map like @c observable does.
+ *
+ *  @tparam  key_type      Type of key.
+ *  @tparam  mapped_type   Type of value.
+ *  @tparam  map_type      Underlying map type.
+ */
+template<typename key_type, typename mapped_type,
+    typename map_type = std::unordered_map<key_type, mapped_type>>
+struct observable_map {
+
+    /**
+     *  @brief  Underlying map, do not modify it directly.
+     */
+    map_type values;
+
+    /**
+     *  @brief  Signal emitted after every modification.
+     */
+    signal<const map_change<key_type> &> changed;
+
+    /**
+     *  @brief  Signal emitted before @c changed , to invalidate dependent
+     *          computed properties.
+     */
+    signal<> invalidated;
+
+    /**
+     *  @brief   Get the underlying map.
+     *  @return  Constant reference to underlying map.
+     */
+    [[nodiscard]] inline auto get() const -> const map_type &
+    {
+        computed_base::track_read(invalidated);
+        return values;
+    }
+
+    /**
+     *  @brief   Get the number of elements.
+     *  @return  Number of elements.
+     */
+    [[nodiscard]] inline auto size() const -> std::size_t
+    {
+        return get().size();
+    }
+
+    /**
+     *  @brief   Check whether the key exists.
+     *
+     *  @param   key  Key to find.
+     *  @return  True if the key exists.
+     */
+    [[nodiscard]] inline auto contains(const key_type &key) const -> bool
+    {
+        return get().contains(key);
+    }
+
+    /**
+     *  @brief   Get the value of a key.
+     *
+     *  @param   key  Key to find.
+     *  @return  Constant reference to value.
+     *  @throw   std::out_of_range  If the key does not exist.
+     */
+    [[nodiscard]] inline auto at(const key_type &key) const
+    -> const mapped_type &
+    {
+        return get().at(key);
+    }
+
+    /**
+     *  @brief  Insert or replace the value of a key and notify.
+     *
+     *  @param  key    Key.
+     *  @param  value  Value.
+     */
+    inline auto set(const key_type &key, mapped_type value) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::observable_map::set");
+
+        auto [it, inserted] = values.insert_or_assign(key, std::move(value));
+        notify({ inserted ? change_kind::insert : change_kind::update,
+                 &it->first });
+    }
+
+    /**
+     *  @brief   Modify the value of an existing key in-place and notify.
+     *
+     *  @tparam  operation_type  Type of operation, called with
+     *                           @c mapped_type & .
+     *  @param   key             Key.
+     *  @param   operation       Operation modifying the value.
+     *  @return  False if the key does not exist.
+     */
+    template<typename operation_type>
+    inline auto modify(
+        const key_type   &key,
+        operation_type &&operation
+    ) -> bool
+    {
+        auto it = values.find(key);
+        if (it == values.end()) return false;
+
+        operation(it->second);
+        notify({ change_kind::update, &it->first });
+        return true;
+    }
+
+    /**
+     *  @brief   Erase a key and notify.
+     *
+     *  @param   key  Key to erase.
+     *  @return  False if the key does not exist.
+     */
+    inline auto erase(const key_type &key) -> bool
+    {
+        auto it = values.find(key);
+        if (it == values.end()) return false;
+
+        // Keep the key alive for the event
+        auto node = values.extract(it);
+        notify({ change_kind::erase, &node.key() });
+        return true;
+    }
+
+    /**
+     *  @brief  Erase all the elements and notify.
+     */
+    inline auto clear() -> void
+    {
+        values.clear();
+        notify({ change_kind::clear, nullptr });
+    }
+
+    /**
+     *  @brief  Emit the change.
+     *  @param  change  Change to emit.
+     */
+    inline auto notify(const map_change<key_type> &change) -> void
+    {
+        invalidated.emit();
+        changed.emit(change);
+    }
+};
+
+/**
+ *  @brief  Executor which runs a task, possibly on another thread.
+ */
+using executor = std::function<void (std::function<void ()>)>;
+
+/**
+ *  @brief  Thread-safe queue of tasks, run by the thread calling @c run .
+ *
+ *  Use @c executor() to deliver notifications of @c atomic_observable on a
+ *  specific thread (e.g., UI thread):
+    ```cpp
+    prop::task_queue ui_tasks;
+    prop::atomic_observable<stats> published;
+    published.notify_on = ui_tasks.executor();
+
+    // Every frame, on UI thread
+    ui_tasks.run();
+    ```
+ */
+struct task_queue {
+
+    /**
+     *  @brief  Mutex protecting @c tasks .
+     */
+    std::mutex mutex;
+
+    /**
+     *  @brief  Tasks posted and not yet run.
+     */
+    std::vector<std::function<void ()>> tasks;
+
+    /**
+     *  @brief  Post a task to run later.
+     *  @param  task  Task to run.
+     */
+    inline auto post(std::function<void ()> task) -> void
+    {
+        std::lock_guard lock(mutex);
+        tasks.emplace_back(std::move(task));
+    }
+
+    /**
+     *  @brief   Run all the tasks posted so far, in order.
+     *  @return  Number of tasks run.
+     */
+    inline auto run() -> std::size_t
+    {
+        std::vector<std::function<void ()>> running;
+        {
+            std::lock_guard lock(mutex);
+            running.swap(tasks);
+        }
+
+        for (auto &task : running) task();
+        return running.size();
+    }
+
+    /**
+     *  @brief   Get an executor posting tasks to this queue.
+     *  @return  Executor referencing this queue.
+     */
+    [[nodiscard]] inline auto executor() -> prop::executor
+    {
+        return [&](std::function<void ()> task) {
+            post(std::move(task));
+        };
+    }
+};
+
+/**
+ *  @brief   Storage for a trivially copyable value using a sequence lock.
+ *
+ *  Readers never block writers: they retry when a write happened while they
+ *  were reading.  Writers are serialized by the sequence itself.  The value
+ *  is stored as relaxed atomic words, so concurrent access is free of data
+ *  races.
+ *
+ *  @tparam  type  Trivially copyable, default constructible type.
+ */
+template<typename type>
+requires(std::is_trivially_copyable_v<type>
+      && std::is_default_constructible_v<type>)
+struct seqlock {
+
+    /**
+     *  @brief  Number of words to store the value.
+     */
+    static constexpr std::size_t words =
+        (sizeof (type) + sizeof (std::size_t) - 1) / sizeof (std::size_t);
+
+    /**
+     *  @brief  Sequence, odd while a write is in progress.
+     */
+    std::atomic<std::size_t> sequence = 0;
+
+    /**
+     *  @brief  Value stored as words.
+     */
+    std::array<std::atomic<std::size_t>, words> data = {};
+
+    /**
+     *  @brief  Creates a storage with provided value.
+     *  @param  value  Initial value.
+     */
+    inline seqlock(const type &value)
+    {
+        store_words(value);
+    }
+
+    /**
+     *  @brief   Read the value, retrying if a write happened meanwhile.
+     *  @return  Copy of the value.
+     */
+    [[nodiscard]] inline auto load() const -> type
+    {
+        std::array<std::size_t, words> buffer = {};
+        while (true)
+        {
+            std::size_t before = sequence.load(std::memory_order_acquire);
+            if (before & 1) continue;
+
+            for (std::size_t i = 0; i < words; i++)
+            {
+                buffer[i] = data[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (sequence.load(std::memory_order_relaxed) == before) break;
+        }
+
+        type value;
+        std::memcpy((void *)&value, buffer.data(), sizeof (type));
+        return value;
+    }
+
+    /**
+     *  @brief   Modify the value exclusively from other writers.
+     *
+     *  @tparam  operation_type  Type of operation, called with @c type & .
+     *  @param   operation       Operation modifying the value.
+     *  @return  Modified value.
+     */
+    template<typename operation_type>
+    inline auto modify(operation_type &&operation) -> type
+    {
+        // Acquire the write side by making the sequence odd
+        std::size_t current = sequence.load(std::memory_order_relaxed);
+        while ((current & 1)
+            || !sequence.compare_exchange_weak(current, current + 1,
+                std::memory_order_acquire, std::memory_order_relaxed))
+        {
+            current = sequence.load(std::memory_order_relaxed);
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+
+        std::array<std::size_t, words> buffer = {};
+        for (std::size_t i = 0; i < words; i++)
+        {
+            buffer[i] = data[i].load(std::memory_order_relaxed);
+        }
+
+        type value;
+        std::memcpy((void *)&value, buffer.data(), sizeof (type));
+        operation(value);
+        store_words(value);
+
+        sequence.store(current + 2, std::memory_order_release);
+        return value;
+    }
+
+    /**
+     *  @brief  Write the value.
+     *  @param  value  Value to write.
+     */
+    inline auto store(const type &value) -> void
+    {
+        modify([&](type &stored) { stored = value; });
+    }
+
+    /**
+     *  @brief  Write the words of the value, without touching the sequence.
+     *  @param  value  Value to write.
+     */
+    inline auto store_words(const type &value) -> void
+    {
+        std::array<std::size_t, words> buffer = {};
+        std::memcpy(buffer.data(), &value, sizeof (type));
+        for (std::size_t i = 0; i < words; i++)
+        {
+            data[i].store(buffer[i], std::memory_order_relaxed);
+        }
+    }
+};
+
+/**
+ *  @brief   An observable which can be read and written from multiple threads
+ *           concurrently.
+ *
+ *  If @c std::atomic<type> is always lock-free, the value is stored in it and
+ *  compound operators are compare-and-swap loops.  Otherwise, the value is
+ *  stored in a @c seqlock , where reads are lock-free and retried on a
+ *  concurrent write.
+ *
+ *  The observer is called on the writing thread, or posted to @c notify_on if
+ *  set (e.g., to @c task_queue::executor() ).
+ *
+ *  @tparam  type  Trivially copyable type.
+ *  @note    Set @c observer and @c notify_on before sharing the observable
+ *           between threads.  The observable must outlive the notifications
+ *           posted to the executor.  It is not tracked by @c computed .
+ */
+template<typename type>
+requires(std::is_trivially_copyable_v<type>
+      && std::is_default_constructible_v<type>)
+struct atomic_observable
+    : property_readonly_operators<atomic_observable<type>, type>,
+    property_operators<atomic_observable<type>, type> {
+
+    /**
+     *  @brief  Whether the value is stored in a lock-free @c std::atomic .
+     */
+    static constexpr bool lock_free = std::atomic<type>::is_always_lock_free;
+
+    /**
+     *  @brief  Storage of the value.
+     */
+    std::conditional_t<lock_free, std::atomic<type>, seqlock<type>> storage;
+
+    /**
+     *  @brief  Observer, called with the new value when the value is changed.
+     */
+    std::function<void (const type &)> observer;
+
+    /**
+     *  @brief  Executor to run the observer on, or empty to call the observer
+     *          on the writing thread.
+     */
+    prop::executor notify_on;
+
+    /**
+     *  @brief  Creates an atomic observable with default value.
+     */
+    inline atomic_observable() : storage(type()) {}
+
+    /**
+     *  @brief  Creates an atomic observable with provided value.
+     *  @param  value  Initial value.
+     */
+    inline atomic_observable(const type &value) : storage(value) {}
+
+    /**
+     *  @brief  Creates an atomic observable with default value and observer.
+     *
+     *  @param  observer   Observer function.
+     *  @param  notify_on  Executor to run the observer on (optional).
+     */
+    inline atomic_observable(
+        std::function<void (const type &)> observer,
+        prop::executor                     notify_on = {}
+    ) : storage(type()), observer(std::move(observer)),
+        notify_on(std::move(notify_on)) {}
+
+    /**
+     *  @brief   Read the value.
+     *  @return  Copy of the value.
+     */
+    [[nodiscard]] inline auto get() const -> type
+    {
+        if constexpr (lock_free) return storage.load(std::memory_order_acquire);
+        else return storage.load();
+    }
+
+    /**
+     *  @brief  Write the value and notify.
+     *  @param  value  Value to set.
+     */
+    inline auto set(const type &value) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::atomic_observable::set");
+
+        if constexpr (lock_free) storage.store(value, std::memory_order_release);
+        else storage.store(value);
+        notify(value);
+    }
+
+    /**
+     *  @brief   Atomically modify the value and notify.
+     *
+     *  @tparam  operation_type  Type of operation, called with @c type & .
+     *  @param   operation       Operation modifying the value, may be called
+     *                           more than once.
+     */
+    template<typename operation_type>
+    inline auto modify(operation_type &&operation) -> void
+    {
+        if constexpr (lock_free)
+        {
+            type expected = storage.load(std::memory_order_relaxed);
+            type desired  = expected;
+            do
+            {
+                desired = expected;
+                operation(desired);
+            }
+            while (!storage.compare_exchange_weak(expected, desired,
+                std::memory_order_acq_rel, std::memory_order_relaxed));
+            notify(desired);
+        }
+        else
+        {
+            notify(storage.modify(operation));
+        }
+    }
+
+    /**
+     *  @brief  Observer call posted to @c notify_on , with its own copy of the
+     *          value as the write may be long gone when it runs.
+     */
+    struct notification {
+
+        /**
+         *  @brief  Observable to notify.
+         */
+        atomic_observable *observable = nullptr;
+
+        /**
+         *  @brief  Value that was set.
+         */
+        type value;
+
+        /**
+         *  @brief  Call the observer with the value.
+         */
+        inline auto operator()() const -> void
+        {
+            observable->observer(value);
+        }
+    };
+
+    /**
+     *  @brief  Call the observer, or post it to the executor.
+     *  @param  value  Value that was set.
+     */
+    inline auto notify(const type &value) -> void
+    {
+        if (!observer) return;
+        if (!notify_on)
+        {
+            observer(value);
+            return;
+        }
+
+        notify_on(notification { this, value });
+    }
+
+    // Explicitly inherit operator= from property operators due to interference
+    // with constructor
+    using property_operators<atomic_observable, type>::operator=;
+};
+
+/**
+ *  @brief  Property registered in a @c registry .
+ */
+struct registry_entry {
+
+    /**
+     *  @brief  Name of the property.
+     */
+    std::string name;
+
+    /**
+     *  @brief  Registered property.
+     */
+    void *property = nullptr;
+
+    /**
+     *  @brief  Size of the value in bytes, zero if the value is not trivially
+     *          copyable and thus not part of snapshots.
+     */
+    std::size_t size = 0;
+
+    /**
+     *  @brief  Copy the value of @c property into @c data .
+     */
+    void (*save)(const void *property, unsigned char *data) = nullptr;
+
+    /**
+     *  @brief  Set the value of @c property from @c data .
+     */
+    void (*load)(void *property, const unsigned char *data) = nullptr;
+
+    /**
+     *  @brief  Signal emitted when the property changes, if any.
+     */
+    signal<> *source = nullptr;
+
+    /**
+     *  @brief  Connection to @c source .
+     */
+    connection handle;
+
+    /**
+     *  @brief  Whether the property changed since the last save.  Properties
+     *          without @c source are always dirty.
+     */
+    bool dirty = true;
+};
+
+/**
+ *  @brief  Transparent string hash for heterogeneous lookup.
+ */
+struct string_hash {
+
+    /**
+     *  @brief  Enable heterogeneous lookup.
+     */
+    using is_transparent = void;
+
+    /**
+     *  @brief   Hash a string.
+     *
+     *  @param   string  String to hash.
+     *  @return  Hash of string.
+     */
+    [[nodiscard]] inline auto operator() (std::string_view string) const
+    -> std::size_t
+    {
+        return std::hash<std::string_view> {}(string);
+    }
+};
+
+/**
+ *  @brief  Registry of named properties, with bulk serialization into a single
+ *          SD chunk.
+ *
+ *  Entries are stored contiguously in registration order, and indexed by name
+ *  with heterogeneous lookup (no @c std::string is constructed to find a
+ *  @c std::string_view ).  Any property with @c get() and @c set() can be
+ *  registered.  Properties with a trivially copyable value are included in
+ *  snapshots, and properties with an @c invalidated signal (observables,
+ *  proxies, observable containers) are tracked as dirty when they change.
+ *
+ *  A snapshot is one SD chunk containing, for each property, its name and
+ *  its value, each prefixed with its size.  Names make snapshots tolerant of
+ *  added, removed and reordered properties.
+ *
+ *  For example:
+    ```cpp
+    prop::registry settings;
+    settings.add("volume", volume);
+    settings.add("fullscreen", fullscreen);
+
+    settings.save(outfile);     // Everything, in one write
+    settings.autosave(outfile); // Only what changed since, if anything
+    settings.restore_all(infile); // Full snapshot followed by deltas
+    ```
+ *
+ *  @warning  The registry and registered properties must not be moved while
+ *            registered.
+ */
+struct registry {
+
+    /**
+     *  @brief  Entries in registration order.
+     */
+    std::vector<registry_entry> entries;
+
+    /**
+     *  @brief  Index of entries by name.
+     */
+    std::unordered_map<std::string, std::size_t, string_hash, std::equal_to<>>
+    indices;
+
+    /**
+     *  @brief  Slot marking an entry dirty, by index as the entries may be
+     *          reallocated.
+     */
+    struct dirty_marker {
+
+        /**
+         *  @brief  Registry of the entry.
+         */
+        registry *owner = nullptr;
+
+        /**
+         *  @brief  Index of the entry.
+         */
+        std::size_t index = 0;
+
+        /**
+         *  @brief  Mark the entry dirty.
+         */
+        inline auto operator()() const -> void
+        {
+            owner->entries[index].dirty = true;
+        }
+    };
+
+    /**
+     *  @brief  Creates an empty registry.
+     */
+    inline registry() = default;
+
+    registry(const registry &) = delete;
+
+    /**
+     *  @brief  Disconnects from all the registered properties.
+     */
+    inline ~registry()
+    {
+        for (auto &entry : entries)
+        {
+            if (entry.source) entry.source->disconnect(entry.handle);
+        }
+    }
+
+    /**
+     *  @brief   Register a property.
+     *
+     *  @tparam  property_type  Type of property.
+     *  @param   name           Unique name of property.
+     *  @param   property       Property to register.
+     *  @throw   std::invalid_argument  If the name is already registered.
+     */
+    template<typename property_type>
+    requires requires(property_type &property) {
+        property.set(property.get());
+    }
+    inline auto add(std::string name, property_type &property) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::add");
+
+        using value_type = std::remove_cvref_t<decltype(property.get())>;
+
+        if (indices.contains(name))
+        {
+            throw std::invalid_argument(std::format(
+                "Property {} is already registered", name));
+        }
+
+        registry_entry entry = {};
+        entry.name     = name;
+        entry.property = &property;
+
+        if constexpr (std::is_trivially_copyable_v<value_type>
+                   && std::is_default_constructible_v<value_type>)
+        {
+            entry.size = sizeof (value_type);
+            entry.save = [](const void *property, unsigned char *data) {
+                value_type value = ((const property_type *)property)->get();
+                std::memcpy(data, &value, sizeof (value_type));
+            };
+            entry.load = [](void *property, const unsigned char *data) {
+                value_type value;
+                std::memcpy((void *)&value, data, sizeof (value_type));
+                ((property_type *)property)->set(value);
+            };
+        }
+
+        std::size_t index = entries.size();
+        if constexpr (requires { { property.invalidated } -> std::same_as<
+                          signal<> &>; })
+        {
+            entry.source = &property.invalidated;
+            entry.handle = property.invalidated.connect(
+                dirty_marker { this, index });
+        }
+
+        entries.emplace_back(std::move(entry));
+        indices.emplace(std::move(name), index);
+    }
+
+    /**
+     *  @brief   Find a property by name.
+     *
+     *  @param   name  Name of property.
+     *  @return  Pointer to entry, or null if not registered.
+     */
+    [[nodiscard]] inline auto find(std::string_view name) -> registry_entry *
+    {
+        auto it = indices.find(name);
+        if (it == indices.end()) return nullptr;
+        return &entries[it->second];
+    }
+
+    /**
+     *  @brief   Check whether a property is registered.
+     *
+     *  @param   name  Name of property.
+     *  @return  True if registered.
+     */
+    [[nodiscard]] inline auto contains(std::string_view name) const -> bool
+    {
+        return indices.find(name) != indices.end();
+    }
+
+    /**
+     *  @brief   Get the number of registered properties.
+     *  @return  Number of registered properties.
+     */
+    [[nodiscard]] inline auto size() const -> std::size_t
+    {
+        return entries.size();
+    }
+
+    /**
+     *  @brief   Serialize the trivially copyable properties into one chunk.
+     *
+     *  @param   dirty_only  Only include properties changed since last save.
+     *  @return  Chunk containing names and values.
+     */
+    [[nodiscard]] inline auto snapshot(bool dirty_only = false) const
+    -> file::sd_chunk
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::snapshot");
+
+        // Compute the size first to allocate once
+        std::size_t size = 0;
+        for (auto &entry : entries)
+        {
+            if (!included(entry, dirty_only)) continue;
+            size += 2 * sizeof (std::size_t) + entry.name.size() + entry.size;
+        }
+
+        file::sd_chunk chunk(size);
+        unsigned char *data = chunk.data();
+
+        auto append_size = [&](std::size_t value) {
+            std::memcpy(data, &value, sizeof (std::size_t));
+            data += sizeof (std::size_t);
+        };
+
+        for (auto &entry : entries)
+        {
+            if (!included(entry, dirty_only)) continue;
+
+            append_size(entry.name.size());
+            std::memcpy(data, entry.name.data(), entry.name.size());
+            data += entry.name.size();
+
+            append_size(entry.size);
+            entry.save(entry.property, data);
+            data += entry.size;
+        }
+
+        return chunk;
+    }
+
+    /**
+     *  @brief   Set registered properties from a chunk made by @c snapshot .
+     *           Notifications are coalesced using a @c batch , and unknown
+     *           names are skipped.
+     *
+     *  @param   chunk  Chunk containing names and values.
+     *  @return  Number of properties restored.
+     *  @throw   std::invalid_argument  If the chunk is malformed or a value
+     *                                  size does not match.
+     */
+    inline auto restore(const file::sd_chunk &chunk) -> std::size_t
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::restore");
+
+        const unsigned char *data = chunk.data();
+        const unsigned char *end  = chunk.data() + chunk.size();
+
+        auto read_size = [&]() {
+            if ((std::size_t)(end - data) < sizeof (std::size_t))
+            {
+                throw std::invalid_argument("Malformed registry snapshot");
+            }
+
+            std::size_t value = 0;
+            std::memcpy(&value, data, sizeof (std::size_t));
+            data += sizeof (std::size_t);
+
+            if ((std::size_t)(end - data) < value)
+            {
+                throw std::invalid_argument("Malformed registry snapshot");
+            }
+            return value;
+        };
+
+        std::vector<registry_entry *> restored;
+        {
+            prop::batch batch;
+            while (data != end)
+            {
+                std::size_t name_size = read_size();
+                std::string_view name((const char *)data, name_size);
+                data += name_size;
+
+                std::size_t value_size = read_size();
+                auto       *entry      = find(name);
+                if (entry && entry->size)
+                {
+                    if (entry->size != value_size)
+                    {
+                        throw std::invalid_argument(std::format(
+                            "Property {} size ({}) does not match snapshot "
+                            "size ({})", name, entry->size, value_size));
+                    }
+                    entry->load(entry->property, data);
+                    restored.emplace_back(entry);
+                }
+                data += value_size;
+            }
+        }
+
+        // Restored values match the storage
+        for (auto &entry : restored)
+        {
+            if (entry->source) entry->dirty = false;
+        }
+
+        return restored.size();
+    }
+
+    /**
+     *  @brief   Write all the trivially copyable properties as one chunk, and
+     *           mark them clean.
+     *
+     *  @param   output  Output stream to write to.
+     *  @return  Number of properties written.
+     */
+    inline auto save(std::ostream &output) -> std::size_t
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::save");
+
+        return write(output, false);
+    }
+
+    /**
+     *  @brief   Write the properties changed since the last save as one chunk,
+     *           and mark them clean.  Nothing is written if nothing changed.
+     *
+     *  @param   output  Output stream to write to.
+     *  @return  Number of properties written.
+     */
+    inline auto autosave(std::ostream &output) -> std::size_t
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::autosave");
+
+        return write(output, true);
+    }
+
+    /**
+     *  @brief   Read one chunk and restore the properties from it.
+     *
+     *  @param   input  Input stream to read from.
+     *  @return  Number of properties restored.
+     */
+    inline auto restore(std::istream &input) -> std::size_t
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::restore");
+
+        return restore(file::read_chunk(input));
+    }
+
+    /**
+     *  @brief   Read chunks until end of stream (i.e., a @c save followed by
+     *           any number of @c autosave ) and restore the properties.
+     *
+     *  @param   input  Input stream to read from.
+     *  @return  Number of chunks read.
+     */
+    inline auto restore_all(std::istream &input) -> std::size_t
+    {
+        ALCELIN_COUNT_ALLOCS("prop::registry::restore_all");
+
+        std::size_t chunks = 0;
+        while (input.peek() != std::char_traits<char>::eof())
+        {
+            restore(input);
+            chunks++;
+        }
+        return chunks;
+    }
+
+    /**
+     *  @brief   Check whether an entry is included in a snapshot.
+     *
+     *  @param   entry       Registered entry.
+     *  @param   dirty_only  Only include properties changed since last save.
+     *  @return  True if included.
+     */
+    [[nodiscard]] static inline auto included(
+        const registry_entry &entry,
+        bool                  dirty_only
+    ) -> bool
+    {
+        return entry.size && (!dirty_only || entry.dirty);
+    }
+
+    /**
+     *  @brief   Write a snapshot and mark the written properties clean.
+     *
+     *  @param   output      Output stream to write to.
+     *  @param   dirty_only  Only include properties changed since last save.
+     *  @return  Number of properties written.
+     */
+    inline auto write(std::ostream &output, bool dirty_only) -> std::size_t
+    {
+        std::size_t count = std::ranges::count_if(entries, [&](auto &entry) {
+            return included(entry, dirty_only);
+        });
+        if (dirty_only && count == 0) return 0;
+
+        file::write_chunk(output, snapshot(dirty_only));
+        for (auto &entry : entries)
+        {
+            if (included(entry, dirty_only) && entry.source)
+            {
+                entry.dirty = false;
+            }
+        }
+        return count;
+    }
+
+    auto operator= (const registry &) -> registry & = delete;
+};
+
+/**
+ *  @brief  Property tracked by a @c journal .
+ */
+struct journal_target {
+
+    /**
+     *  @brief  Tracked property.
+     */
+    void *property = nullptr;
+
+    /**
+     *  @brief  Size of the value in a record in bytes, the size of a pointer
+     *          for values that are stored in owned slots.
+     */
+    std::uint32_t size = 0;
+
+    /**
+     *  @brief  Set the value of @c property from @c data .
+     */
+    void (*load)(void *property, const unsigned char *data) = nullptr;
+
+    /**
+     *  @brief  Copy the old and the new value into owned slots and their
+     *          pointers into @c data , or null to copy the values byte-wise.
+     */
+    void (*store)(unsigned char *data, const void *old_value,
+        const void *new_value) = nullptr;
+
+    /**
+     *  @brief  Destroy the owned slot pointed to from @c data , or null if the
+     *          values are copied byte-wise.
+     */
+    void (*release)(unsigned char *data) = nullptr;
+
+    /**
+     *  @brief  Disconnect from the property, if connected.
+     */
+    inplace_function<void()> untrack;
+};
+
+/**
+ *  @brief  Journal of property changes, for undo/redo and replay.
+ *
+ *  Changes are recorded into a fixed-size arena used as a ring buffer, so the
+ *  memory usage is bounded by the capacity given at construction and nothing
+ *  is allocated per change.  When the arena is full, the oldest records are
+ *  dropped.  Each record is a small header followed by the old and the new
+ *  value, copied byte-wise.
+ *
+ *  Values that are not trivially copyable (e.g., @c std::string ) are
+ *  copy-constructed into slots owned by the journal instead, and the record
+ *  holds pointers to them.  Recording such a change allocates the two slots,
+ *  and the slots are destroyed with the record.
+ *
+ *  Observables and proxies are recorded automatically through their
+ *  @c transitioned signal.  Other properties are recorded when set through
+ *  @c journal::set .  Changes made between @c begin_frame and @c end_frame are
+ *  undone and redone together, otherwise each change is a step on its own.
+ *
+ *  For example:
+    ```cpp
+    prop::journal journal(4096);
+    journal.track(position);
+
+    journal.begin_frame();
+    position = 10;
+    position = 20;
+    journal.end_frame();
+
+    journal.undo(); // Position is back to its value before the frame
+    journal.redo(); // Position is 20 again
+    ```
+ *
+ *  @warning  The journal and tracked properties must not be moved while
+ *            tracked.
+ */
+struct journal {
+
+    /**
+     *  @brief  Header of a record, followed by the old and the new value.
+     */
+    struct header {
+
+        /**
+         *  @brief  Index of the target.
+         */
+        std::uint32_t target = 0;
+
+        /**
+         *  @brief  Frame of the record.
+         */
+        std::uint32_t frame = 0;
+
+        /**
+         *  @brief  Offset of the previous record, or @c npos .
+         */
+        std::uint32_t previous = 0;
+
+        /**
+         *  @brief  Offset of the next record, or @c npos .
+         */
+        std::uint32_t next = 0;
+    };
+
+    /**
+     *  @brief  No record.
+     */
+    static constexpr std::uint32_t npos = (std::uint32_t)-1;
+
+    /**
+     *  @brief  Arena storing the records.
+     */
+    std::vector<unsigned char> arena;
+
+    /**
+     *  @brief  Tracked properties.
+     */
+    std::vector<journal_target> targets;
+
+    /**
+     *  @brief  Offset of the oldest record.
+     */
+    std::uint32_t oldest = npos;
+
+    /**
+     *  @brief  Offset of the newest record.
+     */
+    std::uint32_t newest = npos;
+
+    /**
+     *  @brief  Offset of the newest record not undone.
+     */
+    std::uint32_t cursor = npos;
+
+    /**
+     *  @brief  Number of records.
+     */
+    std::size_t records = 0;
+
+    /**
+     *  @brief  Number of records not undone.
+     */
+    std::size_t applied = 0;
+
+    /**
+     *  @brief  Bytes used by the records.
+     */
+    std::size_t used = 0;
+
+    /**
+     *  @brief  Number of records dropped to make space.
+     */
+    std::size_t dropped = 0;
+
+    /**
+     *  @brief  Current frame.
+     */
+    std::uint32_t frame = 0;
+
+    /**
+     *  @brief  Depth of nested frames.
+     */
+    std::size_t frame_depth = 0;
+
+    /**
+     *  @brief  Whether the journal is applying records, which are not
+     *          recorded again.
+     */
+    bool replaying = false;
+
+    /**
+     *  @brief  Creates a journal.
+     *
+     *  @param  capacity  Size of the arena in bytes.
+     *  @throw  std::invalid_argument  If capacity does not fit offsets.
+     */
+    inline journal(std::size_t capacity) : arena(capacity)
+    {
+        if (capacity >= npos)
+        {
+            throw std::invalid_argument(std::format(
+                "Journal capacity ({}) is too large", capacity));
+        }
+    }
+
+    journal(const journal &) = delete;
+
+    /**
+     *  @brief  Disconnects from all the tracked properties.
+     */
+    inline ~journal()
+    {
+        for (auto &target : targets)
+        {
+            if (target.untrack) target.untrack();
+        }
+        clear();
+    }
+
+    /**
+     *  @brief   Track a property.
+     *
+     *  @tparam  property_type  Type of property.
+     *  @param   property       Property to track.
+     *  @throw   std::invalid_argument  If a record would not fit the arena.
+     */
+    template<typename property_type>
+    requires requires(property_type &property) {
+        property.set(property.get());
+    }
+    inline auto track(property_type &property) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::journal::track");
+
+        using value_type = std::remove_cvref_t<decltype(property.get())>;
+
+        // Other values are stored in owned slots
+        constexpr bool compact = std::is_trivially_copyable_v<value_type>
+                              && std::is_default_constructible_v<value_type>;
+        constexpr std::size_t size = compact ? sizeof (value_type)
+                                             : sizeof (value_type *);
+
+        if (record_size(size) > arena.size())
+        {
+            throw std::invalid_argument(std::format(
+                "Journal capacity ({}) is too small for a value of size {}",
+                arena.size(), size));
+        }
+
+        journal_target target = {};
+        target.property = &property;
+        target.size     = size;
+
+        if constexpr (compact)
+        {
+            target.load = [](void *property, const unsigned char *data) {
+                value_type value;
+                std::memcpy((void *)&value, data, sizeof (value_type));
+                ((property_type *)property)->set(value);
+            };
+        }
+        else
+        {
+            target.load = [](void *property, const unsigned char *data) {
+                value_type *value = nullptr;
+                std::memcpy(&value, data, sizeof (value_type *));
+                ((property_type *)property)->set(*value);
+            };
+            target.store = [](
+                unsigned char *data,
+                const void    *old_value,
+                const void    *new_value
+            ) {
+                auto old_slot = std::make_unique<value_type>(
+                    *(const value_type *)old_value);
+                auto new_slot = std::make_unique<value_type>(
+                    *(const value_type *)new_value);
+
+                value_type *slots[] = {
+                    old_slot.release(), new_slot.release()
+                };
+                std::memcpy(data, slots, sizeof (slots));
+            };
+            target.release = [](unsigned char *data) {
+                value_type *value = nullptr;
+                std::memcpy(&value, data, sizeof (value_type *));
+                delete value;
+            };
+        }
+
+        std::uint32_t index = targets.size();
+        if constexpr (requires { property.transitioned; })
+        {
+            auto handle = property.transitioned.connect(
+                recorder<value_type> { this, index });
+            target.untrack = untracker<decltype(property.transitioned)> {
+                &property.transitioned, handle
+            };
+        }
+
+        targets.emplace_back(std::move(target));
+    }
+
+    /**
+     *  @brief   Set a tracked property, recording the change if the property
+     *           is not recorded automatically.
+     *
+     *  @tparam  property_type  Type of property.
+     *  @tparam  type           Type of value.
+     *  @param   property       Tracked property.
+     *  @param   value          Value to set.
+     *  @throw   std::invalid_argument  If the property is not tracked.
+     */
+    template<typename property_type, typename type>
+    inline auto set(property_type &property, const type &value) -> void
+    {
+        ALCELIN_COUNT_ALLOCS("prop::journal::set");
+
+        using value_type = std::remove_cvref_t<decltype(property.get())>;
+
+        // Few properties are tracked, linear search is faster than a map
+        auto it = std::ranges::find(targets, (void *)&property,
+            &journal_target::property);
+        if (it == targets.end())
+        {
+            throw std::invalid_argument("Property is not tracked");
+        }
+
+        if (it->untrack)
+        {
+            property.set(value);
+            return;
+        }
+
+        value_type old_value = property.get();
+        property.set(value);
+        value_type new_value = property.get();
+        record(it - targets.begin(), &old_value, &new_value);
+    }
+
+    /**
+     *  @brief  Group the following changes in one frame, until the matching
+     *          @c end_frame .  Frames may be nested.
+     */
+    inline auto begin_frame() -> void
+    {
+        if (frame_depth++ == 0) frame++;
+    }
+
+    /**
+     *  @brief  End the frame started by @c begin_frame .
+     */
+    inline auto end_frame() -> void
+    {
+        if (frame_depth) frame_depth--;
+    }
+
+    /**
+     *  @brief   Undo the newest frame not undone.
+     *  @return  Number of changes undone.
+     */
+    inline auto undo() -> std::size_t
+    {
+        if (cursor == npos) return 0;
+
+        replay_guard  guard(*this);
+        std::uint32_t undo_frame = read_header(cursor).frame;
+        std::size_t   count      = 0;
+
+        while (cursor != npos)
+        {
+            header record = read_header(cursor);
+            if (record.frame != undo_frame) break;
+
+            apply(record, cursor + sizeof (header));
+            cursor = record.previous;
+            applied--;
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     *  @brief   Redo the oldest frame undone.
+     *  @return  Number of changes redone.
+     */
+    inline auto redo() -> std::size_t
+    {
+        replay_guard guard(*this);
+        std::size_t  count      = 0;
+        std::uint32_t redo_frame = 0;
+
+        while (cursor != newest)
+        {
+            std::uint32_t next   = cursor == npos
+                                 ? oldest : read_header(cursor).next;
+            header        record = read_header(next);
+            if (count == 0) redo_frame = record.frame;
+            if (record.frame != redo_frame) break;
+
+            apply(record, next + sizeof (header) + targets[record.target].size);
+            cursor = next;
+            applied++;
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     *  @brief   Undo every change in the journal.
+     *  @return  Number of changes undone.
+     */
+    inline auto rewind() -> std::size_t
+    {
+        std::size_t count = 0;
+        while (std::size_t undone = undo()) count += undone;
+        return count;
+    }
+
+    /**
+     *  @brief   Redo every undone change in the journal, in the order they
+     *           were recorded.
+     *  @return  Number of changes redone.
+     */
+    inline auto replay() -> std::size_t
+    {
+        std::size_t count = 0;
+        while (std::size_t redone = redo()) count += redone;
+        return count;
+    }
+
+    /**
+     *  @brief  Drop every record.
+     */
+    inline auto clear() -> void
+    {
+        for (auto offset = oldest; offset != npos;)
+        {
+            release(offset);
+            offset = read_header(offset).next;
+        }
+
+        oldest  = newest = cursor = npos;
+        records = applied = used = 0;
+    }
+
+    /**
+     *  @brief   Get the size of the arena in bytes.
+     *  @return  Size of the arena in bytes.
+     */
+    [[nodiscard]] inline auto capacity() const -> std::size_t
+    {
+        return arena.size();
+    }
+
+    /**
+     *  @brief   Get the number of changes that can be undone.
+     *  @return  Number of changes that can be undone.
+     */
+    [[nodiscard]] inline auto undo_size() const -> std::size_t
+    {
+        return applied;
+    }
+
+    /**
+     *  @brief   Get the number of changes that can be redone.
+     *  @return  Number of changes that can be redone.
+     */
+    [[nodiscard]] inline auto redo_size() const -> std::size_t
+    {
+        return records - applied;
+    }
+
+    /**
+     *  @brief   Get the size of a record.
+     *
+     *  @param   size  Size of the value in bytes.
+     *  @return  Size of the record in bytes.
+     */
+    [[nodiscard]] static inline constexpr auto record_size(std::size_t size)
+    -> std::size_t
+    {
+        return sizeof (header) + 2 * size;
+    }
+
+    /**
+     *  @brief   Read the header of a record.
+     *
+     *  @param   offset  Offset of the record.
+     *  @return  Header of the record.
+     */
+    [[nodiscard]] inline auto read_header(std::uint32_t offset) const -> header
+    {
+        header record = {};
+        std::memcpy(&record, arena.data() + offset, sizeof (header));
+        return record;
+    }
+
+    /**
+     *  @brief  Write the header of a record.
+     *
+     *  @param  offset  Offset of the record.
+     *  @param  record  Header of the record.
+     */
+    inline auto write_header(std::uint32_t offset, const header &record)
+    -> void
+    {
+        std::memcpy(arena.data() + offset, &record, sizeof (header));
+    }
+
+    /**
+     *  @brief  Destroy the owned slots of a record, if any.
+     *  @param  offset  Offset of the record.
+     */
+    inline auto release(std::uint32_t offset) -> void
+    {
+        auto &target = targets[read_header(offset).target];
+        if (!target.release) return;
+
+        unsigned char *data = arena.data() + offset + sizeof (header);
+        target.release(data);
+        target.release(data + target.size);
+    }
+
+    /**
+     *  @brief  Drop the oldest record.
+     */
+    inline auto drop_oldest() -> void
+    {
+        dropped++;
+        if (oldest == newest)
+        {
+            clear();
+            return;
+        }
+
+        header record = read_header(oldest);
+        release(oldest);
+        used -= record_size(targets[record.target].size);
+        records--;
+        applied--;
+
+        oldest = record.next;
+        header next = read_header(oldest);
+        next.previous = npos;
+        write_header(oldest, next);
+    }
+
+    /**
+     *  @brief  Drop the undone records, which can no longer be redone.
+     */
+    inline auto truncate() -> void
+    {
+        if (cursor == newest) return;
+        if (cursor == npos)
+        {
+            clear();
+            return;
+        }
+
+        header record = read_header(cursor);
+        for (auto offset = record.next; offset != npos;)
+        {
+            header undone = read_header(offset);
+            release(offset);
+            used   -= record_size(targets[undone.target].size);
+            offset  = undone.next;
+        }
+
+        record.next = npos;
+        write_header(cursor, record);
+        newest  = cursor;
+        records = applied;
+    }
+
+    /**
+     *  @brief   Find space for a record, dropping the oldest records as
+     *           needed.
+     *
+     *  @param   size  Size of the record in bytes.
+     *  @return  Offset of the space.
+     */
+    inline auto allocate(std::size_t size) -> std::uint32_t
+    {
+        while (true)
+        {
+            if (records == 0) return 0;
+
+            std::size_t end = newest
+                            + record_size(targets[read_header(newest).target]
+                                          .size);
+
+            if (end > oldest)
+            {
+                // Free space is after newest and before oldest
+                if (arena.size() - end >= size) return end;
+                if (oldest >= size) return 0;
+            }
+            else if (oldest - end >= size)
+            {
+                // Free space is between newest and oldest
+                return end;
+            }
+
+            drop_oldest();
+        }
+    }
+
+    /**
+     *  @brief  Record a change.
+     *
+     *  @param  target     Index of the target.
+     *  @param  old_value  Pointer to the old value.
+     *  @param  new_value  Pointer to the new value.
+     */
+    inline auto record(
+        std::uint32_t target,
+        const void   *old_value,
+        const void   *new_value
+    ) -> void
+    {
+        if (replaying) return;
+
+        truncate();
+
+        auto         &entry  = targets[target];
+        std::size_t   size   = entry.size;
+        std::uint32_t offset = allocate(record_size(size));
+
+        // Values first, nothing is recorded if copying them throws
+        unsigned char *data = arena.data() + offset + sizeof (header);
+        if (entry.store) entry.store(data, old_value, new_value);
+        else
+        {
+            std::memcpy(data, old_value, size);
+            std::memcpy(data + size, new_value, size);
+        }
+
+        if (frame_depth == 0) frame++;
+
+        header record = {
+            .target   = target,
+            .frame    = frame,
+            .previous = newest,
+            .next     = npos
+        };
+        write_header(offset, record);
+
+        if (newest != npos)
+        {
+            header previous = read_header(newest);
+            previous.next = offset;
+            write_header(newest, previous);
+        }
+        else oldest = offset;
+
+        newest = cursor = offset;
+        records++;
+        applied++;
+        used += record_size(size);
+    }
+
+    /**
+     *  @brief  Set a target from a value in the arena.
+     *
+     *  @param  record  Header of the record.
+     *  @param  offset  Offset of the value.
+     */
+    inline auto apply(const header &record, std::size_t offset) -> void
     {
-        external       = value;
-        this->observer = observer;
+        auto &target = targets[record.target];
+        target.load(target.property, arena.data() + offset);
     }
 
-    // Explicitly inherit operator= from property due to interference with
-    // constructor
-    using property<type>::operator=;
+    /**
+     *  @brief   Slot recording the changes of a target.
+     *  @tparam  type  Value type of the target.
+     */
+    template<typename type>
+    struct recorder {
+
+        /**
+         *  @brief  Journal recording.
+         */
+        journal *owner = nullptr;
+
+        /**
+         *  @brief  Index of the target.
+         */
+        std::uint32_t target = 0;
+
+        /**
+         *  @brief  Record a change of the target.
+         *
+         *  @param  old_value  Old value.
+         *  @param  new_value  New value.
+         */
+        inline auto operator()(
+            const type &old_value,
+            const type &new_value
+        ) const -> void
+        {
+            owner->record(target, &old_value, &new_value);
+        }
+    };
+
+    /**
+     *  @brief   Disconnects a @c recorder from its signal.
+     *  @tparam  signal_type  Type of signal.
+     */
+    template<typename signal_type>
+    struct untracker {
+
+        /**
+         *  @brief  Signal the recorder is connected to.
+         */
+        signal_type *source = nullptr;
+
+        /**
+         *  @brief  Connection of the recorder.
+         */
+        connection handle;
+
+        /**
+         *  @brief  Disconnect the recorder.
+         */
+        inline auto operator()() const -> void
+        {
+            source->disconnect(handle);
+        }
+    };
+
+    /**
+     *  @brief  Marks the journal as replaying while in scope.
+     */
+    struct replay_guard {
+
+        /**
+         *  @brief  Journal replaying.
+         */
+        journal &owner;
+
+        /**
+         *  @brief  Marks the journal as replaying.
+         *  @param  owner  Journal replaying.
+         */
+        inline replay_guard(journal &owner) : owner(owner)
+        {
+            owner.replaying = true;
+        }
+
+        /**
+         *  @brief  Unmarks the journal as replaying.
+         */
+        inline ~replay_guard()
+        {
+            owner.replaying = false;
+        }
+    };
+
+    auto operator= (const journal &) -> journal & = delete;
 };
 
 } // namespace prop
@@ -39,16 +39,24 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <cctype>
 #include <cstddef>
 #include <format>
+#include <functional>
+#include <initializer_list>
 #include <iterator>
 #include <ranges>
+#include <span>
 #include <string>
+#include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "alcelin_container_utilities.hpp"
+#include "alcelin_cpu_dispatch.hpp"
 
 /**
  *  @brief  All Alcelin's contents in this namespace.
@@ -78,6 +86,12 @@ concept sm_compatible = cu::cu_compatible<container>
  */
 using result_string_nested = std::vector<std::string>;
 
+/**
+ *  @brief  String Manipulators' @c cu::split_result , the pieces are
+ *          @c std::string_view into one buffer.
+ */
+using split_result = cu::split_result<char, std::string_view>;
+
 /**
  *  @brief   Convert a container to comma separated string.
  *
@@ -100,8 +114,10 @@ requires(!std::is_same_v<converter, std::string>)
     std::string_view separator = ", ",
     std::string_view prefix    = "",
     std::string_view suffix    = ""
-)
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_string");
+
     auto transformer = [&](const cu::value_type<container> &element) {
         ///  @todo  Remove this cast when C++26 comes out.
         return std::string(prefix) + conv(element) + std::string(suffix);
@@ -130,8 +146,10 @@ template<cu::cu_compatible container>
     std::string_view separator = ", ",
     std::string_view prefix    = "",
     std::string_view suffix    = ""
-)
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_string");
+
     return to_string<container, std::string (*)(cu::value_type<container>)>(
         ctr, std::to_string, separator, prefix, suffix);
 }
@@ -156,8 +174,10 @@ requires std::is_same_v<cu::value_type<container>, char>
     std::string_view separator = ", ",
     std::string_view prefix    = "\'",
     std::string_view suffix    = "\'"
-)
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_string");
+
     auto converter = [&](const cu::value_type<container> &element) {
         return std::string(1, element);
     };
@@ -185,8 +205,10 @@ requires std::is_same_v<cu::value_type<container>, std::string>
     std::string_view separator = ", ",
     std::string_view prefix    = "\"",
     std::string_view suffix    = "\""
-)
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_string");
+
     return to_string(ctr, std::identity {}, separator, prefix, suffix);
 }
 
@@ -199,8 +221,12 @@ requires std::is_same_v<cu::value_type<container>, std::string>
  */
 template<cu::cu_compatible container>
 requires std::is_same_v<cu::value_type<container>, char>
-[[nodiscard]] inline constexpr auto chars_to_string(const container &ctr)
+[[nodiscard]] inline constexpr auto chars_to_string(
+    const container &ctr
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::chars_to_string");
+
     return std::string(std::begin(ctr), std::end(ctr));
 }
 
@@ -212,6 +238,8 @@ requires std::is_same_v<cu::value_type<container>, char>
  */
 [[nodiscard]] inline constexpr auto to_string(char character)
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_string");
+
     // Maybe pretty useless after all
     return std::string(1, character);
 }
@@ -243,6 +271,9 @@ requires std::is_same_v<cu::value_type<container>, char>
     std::string_view delims = " \t\r\n\f\v\b"
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::word_wrap");
+    ALCELIN_TRACE_ZONE("sm::word_wrap");
+
     result_string_nested lines = {};
 
     // Functions expect inclusive width, and also works as a measure to have at
@@ -286,6 +317,16 @@ requires std::is_same_v<cu::value_type<container>, char>
     return lines;
 }
 
+/**
+ *  @brief  Shortest string @c trim_left and @c trim_right search with the
+ *          CPU's kernels when it starts (or ends) with a delimiter, shorter
+ *          strings are searched inline (see the @c sm::trim benchmarks).
+ *
+ *  The kernels are only used when linking the compiled library, which defines
+ *  @c ALCELIN_CPU_DISPATCH .
+ */
+inline constexpr std::size_t trim_dispatch_min = 16;
+
 /**
  *  @brief   Trim a string (only from left side) using delimiters (usually
  *           whitespace).
@@ -299,6 +340,29 @@ requires std::is_same_v<cu::value_type<container>, char>
     std::string_view delims = " \t\r\n\f\v\b"
 )
 {
+#ifdef ALCELIN_CPU_DISPATCH
+    // Long runs of delimiters are searched by the CPU's kernels, short strings
+    // and strings with nothing to trim are searched inline
+    if !consteval
+    {
+        if (string.size() >= trim_dispatch_min)
+        {
+            if (delims.find(string.front()) == std::string_view::npos)
+            {
+                return string;
+            }
+
+            auto pos = cpu::kernels().find_first_not_of(string.data(),
+                string.size(), delims.data(), delims.size());
+            if (pos == std::string_view::npos)
+            {
+                return string;
+            }
+            return string.substr(pos);
+        }
+    }
+#endif
+
     auto pos = string.find_first_not_of(delims);
     if (pos == std::string_view::npos)
     {
@@ -320,6 +384,29 @@ requires std::is_same_v<cu::value_type<container>, char>
     std::string_view delims = " \t\r\n\f\v\b"
 )
 {
+#ifdef ALCELIN_CPU_DISPATCH
+    // Long runs of delimiters are searched by the CPU's kernels, short strings
+    // and strings with nothing to trim are searched inline
+    if !consteval
+    {
+        if (string.size() >= trim_dispatch_min)
+        {
+            if (delims.find(string.back()) == std::string_view::npos)
+            {
+                return string;
+            }
+
+            auto pos = cpu::kernels().find_last_not_of(string.data(),
+                string.size(), delims.data(), delims.size());
+            if (pos == std::string_view::npos)
+            {
+                return string;
+            }
+            return string.substr(0, pos + 1);
+        }
+    }
+#endif
+
     auto pos = string.find_last_not_of(delims);
     if (pos == std::string_view::npos)
     {
@@ -351,6 +438,8 @@ requires std::is_same_v<cu::value_type<container>, char>
  */
 [[nodiscard]] inline constexpr auto to_upper(std::string_view string)
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_upper");
+
     std::string str;
     std::ranges::transform(string, std::back_inserter(str), ::toupper);
     return str;
@@ -364,6 +453,8 @@ requires std::is_same_v<cu::value_type<container>, char>
  */
 [[nodiscard]] inline constexpr auto to_lower(std::string_view string)
 {
+    ALCELIN_COUNT_ALLOCS("sm::to_lower");
+
     std::string str;
     std::ranges::transform(string, std::back_inserter(str), ::tolower);
     return str;
@@ -432,6 +523,9 @@ requires std::is_same_v<cu::value_type<container>, char>
     std::string_view pattern
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::filter_out_seq");
+    ALCELIN_TRACE_ZONE("sm::filter_out_seq");
+
     std::vector<char> string_vec(string.begin(), string.end());
     std::vector<char> values_vec(pattern.begin(), pattern.end());
     return sm::chars_to_string(cu::filter_out_seq(string_vec, values_vec));
@@ -451,6 +545,9 @@ requires std::is_same_v<cu::value_type<container>, char>
     std::string_view characters
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::filter_out_occ");
+    ALCELIN_TRACE_ZONE("sm::filter_out_occ");
+
     std::vector<char> string_vec(string.begin(), string.end());
     std::vector<char> values_vec(characters.begin(), characters.end());
     return sm::chars_to_string(cu::filter_out_occ(string_vec, values_vec));
@@ -470,8 +567,11 @@ template<sm_compatible strings>
 [[nodiscard]] inline constexpr auto filter_out_occ_seq(
     std::string_view string,
     const strings   &patterns
-)
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::filter_out_occ_seq");
+    ALCELIN_TRACE_ZONE("sm::filter_out_occ_seq");
+
     std::vector<char> string_vec(string.begin(), string.end());
     std::vector<std::vector<char>> patterns_vec = {};
     for (auto &pattern : patterns)
@@ -496,6 +596,9 @@ template<sm_compatible strings>
     char             character
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::filter_out");
+    ALCELIN_TRACE_ZONE("sm::filter_out");
+
     std::vector<char> string_vec(string.begin(), string.end());
     return sm::chars_to_string(cu::filter_out(string_vec, character));
 }
@@ -514,8 +617,10 @@ template<typename count>
 [[nodiscard]] inline constexpr auto repeat(
     std::string_view string,
     count            n
-)
+) -> std::string
 {
+    ALCELIN_COUNT_ALLOCS("sm::repeat");
+
     std::vector<char> string_vec(string.begin(), string.end());
     return sm::chars_to_string(cu::repeat(string_vec, n));
 }
@@ -534,6 +639,9 @@ template<typename count>
     std::string_view pattern
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::split_seq");
+    ALCELIN_TRACE_ZONE("sm::split_seq");
+
     std::vector<char> string_vec(string.begin(), string.end());
     std::vector<char> pattern_vec(pattern.begin(), pattern.end());
     auto result = cu::split_seq(string_vec, pattern_vec);
@@ -555,6 +663,9 @@ template<typename count>
     std::string_view characters
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::split_occ");
+    ALCELIN_TRACE_ZONE("sm::split_occ");
+
     std::vector<char> string_vec(string.begin(), string.end());
     std::vector<char> pattern_vec(characters.begin(), characters.end());
     auto result = cu::split_occ(string_vec, pattern_vec);
@@ -567,7 +678,7 @@ template<typename count>
  *
  *  @tparam  strings   CU compatible string with string elements.
  *  @param   string    String.
- *  @param   patterns  Patterns to split with.
+ *  @param   patterns  Patterns to split with, empty ones are ignored.
  *  @return  Split string as @c result_string_nested .
  *
  *  @see     cu::split_occ_seq.
@@ -576,8 +687,11 @@ template<sm_compatible strings>
 [[nodiscard]] inline constexpr auto split_occ_seq(
     std::string_view string,
     const strings   &patterns
-)
+) -> result_string_nested
 {
+    ALCELIN_COUNT_ALLOCS("sm::split_occ_seq");
+    ALCELIN_TRACE_ZONE("sm::split_occ_seq");
+
     std::vector<char> string_vec(string.begin(), string.end());
     std::vector<std::vector<char>> patterns_vec = {};
     for (auto &pattern : patterns)
@@ -603,12 +717,452 @@ template<sm_compatible strings>
     char             character
 )
 {
+    ALCELIN_COUNT_ALLOCS("sm::split");
+    ALCELIN_TRACE_ZONE("sm::split");
+
     std::vector<char> string_vec(string.begin(), string.end());
     auto result = cu::split(string_vec, character);
     return std::views::transform(result, sm::chars_to_string<std::vector<char>>)
          | std::ranges::to<result_string_nested>();
 }
 
+/**
+ *  @brief   Split the string with pattern, into one buffer.
+ *
+ *  @param   string   String.
+ *  @param   pattern  Pattern to split with.
+ *  @return  Split string as @c split_result .
+ *
+ *  @see     cu::split_seq_flat.
+ */
+[[nodiscard]] inline constexpr auto split_seq_flat(
+    std::string_view string,
+    std::string_view pattern
+) -> split_result
+{
+    ALCELIN_COUNT_ALLOCS("sm::split_seq_flat");
+    ALCELIN_TRACE_ZONE("sm::split_seq_flat");
+
+    auto split = cu::split_seq_flat(string, pattern);
+    return split_result { std::move(split.values), std::move(split.offsets) };
+}
+
+/**
+ *  @brief   Split the string with occurrences of value, into one buffer.
+ *
+ *  @param   string      String.
+ *  @param   characters  Characters to split with.
+ *  @return  Split string as @c split_result .
+ *
+ *  @see     cu::split_occ_flat.
+ */
+[[nodiscard]] inline constexpr auto split_occ_flat(
+    std::string_view string,
+    std::string_view characters
+) -> split_result
+{
+    ALCELIN_COUNT_ALLOCS("sm::split_occ_flat");
+    ALCELIN_TRACE_ZONE("sm::split_occ_flat");
+
+    auto split = cu::split_occ_flat(string, characters);
+    return split_result { std::move(split.values), std::move(split.offsets) };
+}
+
+/**
+ *  @brief   Split the string with occurrences of any of pattern, into one
+ *           buffer.
+ *
+ *  @tparam  strings   CU compatible string with string elements.
+ *  @param   string    String.
+ *  @param   patterns  Patterns to split with, empty ones are ignored.
+ *  @return  Split string as @c split_result .
+ *
+ *  @see     cu::split_occ_seq_flat.
+ */
+template<sm_compatible strings>
+[[nodiscard]] inline constexpr auto split_occ_seq_flat(
+    std::string_view string,
+    const strings   &patterns
+) -> split_result
+{
+    ALCELIN_COUNT_ALLOCS("sm::split_occ_seq_flat");
+    ALCELIN_TRACE_ZONE("sm::split_occ_seq_flat");
+
+    auto split = cu::split_occ_seq_flat(string, patterns);
+    return split_result { std::move(split.values), std::move(split.offsets) };
+}
+
+/**
+ *  @brief   Split the string with value, into one buffer.
+ *
+ *  @param   string     String.
+ *  @param   character  Character to split with.
+ *  @return  Split string as @c split_result .
+ *
+ *  @see     cu::split_flat.
+ */
+[[nodiscard]] inline constexpr auto split_flat(
+    std::string_view string,
+    char             character
+) -> split_result
+{
+    ALCELIN_COUNT_ALLOCS("sm::split_flat");
+    ALCELIN_TRACE_ZONE("sm::split_flat");
+
+    auto split = cu::split_seq_flat(string, std::string_view(&character, 1));
+    return split_result { std::move(split.values), std::move(split.offsets) };
+}
+
+/**
+ *  @brief   Replace the first occurrence of pattern in the string.
+ *
+ *  @param   string       String.
+ *  @param   pattern      Pattern to replace, nothing is replaced if empty.
+ *  @param   replacement  String to replace with.
+ *  @return  Replaced string.
+ */
+[[nodiscard]] inline constexpr auto replace(
+    std::string_view string,
+    std::string_view pattern,
+    std::string_view replacement
+) -> std::string
+{
+    ALCELIN_COUNT_ALLOCS("sm::replace");
+
+    auto pos = string.find(pattern);
+    if (pattern.empty() || pos == std::string_view::npos)
+    {
+        return std::string(string);
+    }
+
+    std::string result;
+    result.reserve(string.size() - pattern.size() + replacement.size());
+    result.append(string.substr(0, pos));
+    result.append(replacement);
+    result.append(string.substr(pos + pattern.size()));
+    return result;
+}
+
+/**
+ *  @brief   Replace the occurrences of pattern in the string.
+ *
+ *  The occurrences are found from the beginning without overlapping.  The
+ *  first pass counts them to allocate the result once, the second pass copies
+ *  the string with the replacements.
+ *
+ *  @param   string       String.
+ *  @param   pattern      Pattern to replace, nothing is replaced if empty.
+ *  @param   replacement  String to replace with.
+ *  @return  Replaced string.
+ *
+ *  @see     cu::replace_seq.
+ */
+[[nodiscard]] inline constexpr auto replace_all(
+    std::string_view string,
+    std::string_view pattern,
+    std::string_view replacement
+) -> std::string
+{
+    ALCELIN_COUNT_ALLOCS("sm::replace_all");
+    ALCELIN_TRACE_ZONE("sm::replace_all");
+
+    if (pattern.empty()) return std::string(string);
+
+    std::size_t count = 0;
+    for (auto pos = string.find(pattern); pos != std::string_view::npos;
+        pos = string.find(pattern, pos + pattern.size()))
+    {
+        count++;
+    }
+
+    std::string result;
+    result.reserve(string.size() - count * pattern.size()
+        + count * replacement.size());
+
+    std::size_t start = 0;
+    for (auto pos = string.find(pattern); pos != std::string_view::npos;
+        pos = string.find(pattern, start))
+    {
+        result.append(string.substr(start, pos - start));
+        result.append(replacement);
+        start = pos + pattern.size();
+    }
+    result.append(string.substr(start));
+    return result;
+}
+
+/**
+ *  @brief  Patterns and their replacements for @c replace_all , compiled once
+ *          to replace in many strings.
+ *
+ *  The patterns are bucketed by their first character, longest first, so that
+ *  each position only tries the patterns that can start there.  When several
+ *  patterns match at a position, the longest is replaced.
+ */
+struct replace_table {
+
+    /**
+     *  @brief  Patterns and their replacements, sorted by the patterns' first
+     *          characters, then longest first.
+     */
+    std::vector<std::pair<std::string, std::string>> pairs;
+
+    /**
+     *  @brief  Index in @c pairs of the first pattern starting with each
+     *          character, and the end of the last bucket.
+     */
+    std::array<std::size_t, 257> buckets = {};
+
+    /**
+     *  @brief  Compile the patterns and their replacements.
+     *
+     *  @tparam  range  Range of pairs of pattern and replacement.
+     *  @param   list   Pairs of pattern and replacement, empty patterns are
+     *                  ignored, and the first of the same patterns is used.
+     */
+    template<std::ranges::input_range range>
+    inline constexpr explicit replace_table(const range &list)
+    {
+        for (auto &[pattern, replacement] : list)
+        {
+            if (std::string_view(pattern).empty()) continue;
+            pairs.emplace_back(pattern, replacement);
+        }
+
+        std::ranges::stable_sort(pairs, [](auto &a, auto &b) {
+            auto a_first = (unsigned char)a.first[0];
+            auto b_first = (unsigned char)b.first[0];
+            if (a_first != b_first) return a_first < b_first;
+            if (a.first.size() != b.first.size())
+            {
+                return a.first.size() > b.first.size();
+            }
+            return a.first < b.first;
+        });
+
+        auto repeated = std::ranges::unique(pairs, {},
+            &std::pair<std::string, std::string>::first);
+        pairs.erase(repeated.begin(), repeated.end());
+
+        for (auto &[pattern, replacement] : pairs)
+        {
+            buckets[(unsigned char)pattern[0] + 1]++;
+        }
+        for (std::size_t i = 1; i < buckets.size(); i++)
+        {
+            buckets[i] += buckets[i - 1];
+        }
+    }
+
+    /**
+     *  @brief  Compile the patterns and their replacements.
+     *  @param  list  Pairs of pattern and replacement.
+     */
+    inline constexpr replace_table(std::initializer_list<
+        std::pair<std::string_view, std::string_view>> list)
+        : replace_table(std::span(list.begin(), list.end())) {}
+
+    /**
+     *  @brief   Find the longest pattern at the beginning of the string.
+     *
+     *  @param   string  String.
+     *  @return  Pair of the pattern and its replacement, or @c nullptr .
+     */
+    [[nodiscard]] inline constexpr auto match(std::string_view string) const
+        -> const std::pair<std::string, std::string> *
+    {
+        if (string.empty()) return nullptr;
+
+        auto first = (unsigned char)string[0];
+        for (auto i = buckets[first]; i < buckets[first + 1]; i++)
+        {
+            if (string.starts_with(pairs[i].first)) return &pairs[i];
+        }
+        return nullptr;
+    }
+};
+
+/**
+ *  @brief   Replace the occurrences of every pattern in the table.
+ *
+ *  The string is scanned once, replacing the longest pattern at each
+ *  position.  Replacements are not scanned again.  The first pass measures
+ *  the result to allocate it once, the second pass copies the string with
+ *  the replacements.
+ *
+ *  @param   string  String.
+ *  @param   table   Patterns and their replacements.
+ *  @return  Replaced string.
+ */
+[[nodiscard]] inline constexpr auto replace_all(
+    std::string_view     string,
+    const replace_table &table
+) -> std::string
+{
+    ALCELIN_COUNT_ALLOCS("sm::replace_all");
+    ALCELIN_TRACE_ZONE("sm::replace_all");
+
+    // Calls keep for the characters between the occurrences, and replace for
+    // each occurrence
+    auto walk = [&](auto &&keep, auto &&replace) {
+        std::size_t start = 0;
+        std::size_t pos   = 0;
+        while (pos < string.size())
+        {
+            // Skip the characters no pattern starts with without matching
+            auto first = (unsigned char)string[pos];
+            if (table.buckets[first] == table.buckets[first + 1])
+            {
+                pos++;
+                continue;
+            }
+
+            auto pair = table.match(string.substr(pos));
+            if (!pair)
+            {
+                pos++;
+                continue;
+            }
+
+            keep(string.substr(start, pos - start));
+            replace(pair->second);
+            pos  += pair->first.size();
+            start = pos;
+        }
+        keep(string.substr(start));
+    };
+
+    std::size_t size = 0;
+    auto measure = [&](std::string_view part) { size += part.size(); };
+    walk(measure, measure);
+
+    std::string result;
+    result.reserve(size);
+    auto append = [&](std::string_view part) { result.append(part); };
+    walk(append, append);
+    return result;
+}
+
+/**
+ *  @brief  String literal usable as a template argument.
+ *
+ *  @tparam  size  Size of the literal, including the null terminator.
+ */
+template<std::size_t size>
+struct fixed_string {
+
+    /**
+     *  @brief  Characters of the literal, including the null terminator.
+     */
+    std::array<char, size> chars = {};
+
+    /**
+     *  @brief  Copy the literal.
+     *  @param  literal  String literal.
+     */
+    consteval fixed_string(const char (&literal)[size])
+    {
+        std::ranges::copy(literal, chars.begin());
+    }
+
+    /**
+     *  @brief   Get the literal without the null terminator.
+     *  @return  Literal as a string view.
+     */
+    [[nodiscard]] inline constexpr auto view() const -> std::string_view
+    {
+        return std::string_view(chars.data(), size - 1);
+    }
+};
+
+/**
+ *  @brief   Split the string literal with pattern at compile time.
+ *
+ *  The pieces are the same as @c split_seq 's, as views into the literal,
+ *  which is a template argument and lives as long as the program.
+ *
+ *  @tparam  string   String literal.
+ *  @tparam  pattern  Pattern to split with.
+ *  @return  Pieces as an array of @c std::string_view .
+ */
+template<fixed_string string, fixed_string pattern>
+[[nodiscard]] consteval auto static_split_seq()
+{
+    // Calls store for each piece, returning the number of pieces
+    auto walk = [](auto &&store) {
+        std::size_t count = 0;
+        for (auto piece : std::views::split(string.view(), pattern.view()))
+        {
+            store(count++, std::string_view(piece.begin(), piece.end()));
+        }
+        return count;
+    };
+
+    constexpr auto size = walk([](std::size_t, std::string_view) {});
+
+    std::array<std::string_view, size> pieces;
+    walk([&](std::size_t i, std::string_view piece) { pieces[i] = piece; });
+    return pieces;
+}
+
+/**
+ *  @brief   Split the string literal with occurrences of characters at compile
+ *           time.
+ *
+ *  The pieces are the same as @c split_occ 's, as views into the literal,
+ *  which is a template argument and lives as long as the program.
+ *
+ *  @tparam  string      String literal.
+ *  @tparam  characters  Characters to split with.
+ *  @return  Pieces as an array of @c std::string_view .
+ */
+template<fixed_string string, fixed_string characters>
+[[nodiscard]] consteval auto static_split_occ()
+{
+    // Calls store for each piece, returning the number of pieces
+    auto walk = [](auto &&store) {
+        std::size_t count = 0;
+        std::size_t pos   = 0;
+        auto        view  = string.view();
+        while (pos < view.size())
+        {
+            auto next_pos = std::min(view.find_first_of(characters.view(), pos),
+                view.size());
+            store(count++, view.substr(pos, next_pos - pos));
+            pos = next_pos;
+            if (pos != view.size()) pos++;
+        }
+        return count;
+    };
+
+    constexpr auto size = walk([](std::size_t, std::string_view) {});
+
+    std::array<std::string_view, size> pieces;
+    walk([&](std::size_t i, std::string_view piece) { pieces[i] = piece; });
+    return pieces;
+}
+
+/**
+ *  @brief   Split the string literal with character at compile time.
+ *
+ *  For keyword tables and the likes, to have no allocation nor splitting at
+ *  startup:
+ *
+ *  @code
+ *  constexpr auto keywords = sm::static_split<"if,else,while", ','>();
+ *  @endcode
+ *
+ *  @tparam  string     String literal.
+ *  @tparam  character  Character to split with.
+ *  @return  Pieces as an array of @c std::string_view .
+ */
+template<fixed_string string, char character>
+[[nodiscard]] consteval auto static_split()
+{
+    constexpr char pattern[] = { character, '\0' };
+    return static_split_seq<string, pattern>();
+}
+
 } // namespace sm
 
 /**
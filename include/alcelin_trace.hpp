@@ -0,0 +1,284 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Scoped tracing zones with Chrome trace export.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <ostream>
+
+/**
+ *  @brief   Trace the enclosing scope as a zone.
+ *
+ *  Place at the top of a function body or any other scope.  Expands to
+ *  nothing unless Alcelin is built with @c ALCELIN_TRACE , in which case the
+ *  scope is recorded as a zone named @c name while tracing is started.
+ *
+ *  @param   name  Zone name as string literal, like "sm::split".
+ */
+#ifdef ALCELIN_TRACE
+#define ALCELIN_TRACE_ZONE(name) \
+    ::alcelin::trace::zone alcelin_trace_zone(name)
+#else
+#define ALCELIN_TRACE_ZONE(name) static_cast<void>(0)
+#endif
+
+/**
+ *  @brief  All Alcelin's contents in this namespace.
+ */
+namespace alcelin {
+
+/**
+ *  @brief  Scoped tracing zones.
+ *
+ *  Opt-in instrumentation showing where time goes in code built from Alcelin
+ *  calls.  Build with the CMake option @c ALCELIN_TRACE , call @c start , run
+ *  the code, call @c stop and export the zones with @c write_chrome_json to
+ *  view them in Chrome's about://tracing or in Perfetto.  Without the option,
+ *  zones compile to nothing, with it a stopped trace costs a relaxed atomic
+ *  load per zone.
+ *
+ *  Each thread records its zones in its own fixed-size buffer without
+ *  locking.  Zones that do not fit are dropped and counted, see @c dropped .
+ */
+namespace trace {
+
+/**
+ *  @brief  True if Alcelin was built with tracing.
+ */
+#ifdef ALCELIN_TRACE
+inline constexpr bool instrumented = true;
+#else
+inline constexpr bool instrumented = false;
+#endif
+
+/**
+ *  @brief  Maximum number of zones recorded per thread.
+ */
+inline constexpr std::size_t buffer_capacity = 1 << 16;
+
+/**
+ *  @brief  A recorded zone.
+ */
+struct event {
+
+    /**
+     *  @brief  Zone name, a string literal.
+     */
+    const char *name = nullptr;
+
+    /**
+     *  @brief  Start time in nanoseconds of @c std::chrono::steady_clock .
+     */
+    std::int64_t start = 0;
+
+    /**
+     *  @brief  Duration in nanoseconds.
+     */
+    std::int64_t duration = 0;
+};
+
+/**
+ *  @brief  Zones recorded by a thread.
+ *
+ *  Only the owning thread writes, it publishes an event by incrementing
+ *  @c size with release order after writing it.
+ */
+struct thread_buffer {
+
+    /**
+     *  @brief  Index of the thread in order of first zone, used as thread ID.
+     */
+    std::size_t thread = 0;
+
+    /**
+     *  @brief  Recorded zones.
+     */
+    std::unique_ptr<event[]> events =
+        std::make_unique_for_overwrite<event[]>(buffer_capacity);
+
+    /**
+     *  @brief  Number of recorded zones.
+     */
+    std::atomic<std::size_t> size = 0;
+
+    /**
+     *  @brief  Number of zones that did not fit.
+     */
+    std::atomic<std::size_t> dropped = 0;
+};
+
+/**
+ *  @brief  Whether zones are recorded.
+ */
+inline constinit std::atomic<bool> enabled = false;
+
+/**
+ *  @brief  Buffer of the current thread, created on its first zone.
+ */
+inline thread_local constinit thread_buffer *this_thread = nullptr;
+
+/**
+ *  @brief   Create and register the buffer of the current thread.  Buffers
+ *           live until the program exits, so zones of finished threads can
+ *           still be exported.
+ *
+ *  @return  Buffer of the current thread.
+ */
+auto register_thread() -> thread_buffer *;
+
+/**
+ *  @brief  Start recording zones.  The calling thread's buffer is created
+ *          now so that it is not part of the first zone.
+ */
+inline auto start() -> void
+{
+    if (!this_thread) register_thread();
+    enabled.store(true, std::memory_order_relaxed);
+}
+
+/**
+ *  @brief  Stop recording zones.  Zones already started are still recorded
+ *          when they end.
+ */
+inline auto stop() -> void
+{
+    enabled.store(false, std::memory_order_relaxed);
+}
+
+/**
+ *  @brief  Remove the recorded zones of every thread.
+ *
+ *  @note   Call only while no zone is being recorded, after @c stop .
+ */
+auto clear() -> void;
+
+/**
+ *  @brief   Get the number of zones that did not fit in their thread's
+ *           buffer.
+ *
+ *  @return  Number of dropped zones.
+ */
+[[nodiscard]] auto dropped() -> std::size_t;
+
+/**
+ *  @brief   Write the recorded zones in Chrome's trace event JSON format,
+ *           which Perfetto can open too.
+ *
+ *  @param   output  Output stream to write to.
+ *  @return  Number of zones written.
+ */
+auto write_chrome_json(std::ostream &output) -> std::size_t;
+
+/**
+ *  @brief  Records the scope as a zone if tracing is started.  Use
+ *          @c ALCELIN_TRACE_ZONE instead of using this directly.
+ */
+struct zone {
+
+    /**
+     *  @brief  Zone name, null if not recording.
+     */
+    const char *name = nullptr;
+
+    /**
+     *  @brief  Start time in nanoseconds.
+     */
+    std::int64_t start = 0;
+
+    /**
+     *  @brief  Start the zone.
+     *  @param  name  Zone name, a string literal.
+     */
+    inline constexpr zone(const char *name)
+    {
+        if consteval { return; }
+        else
+        {
+            if (!enabled.load(std::memory_order_relaxed)) return;
+            if (!this_thread) register_thread();
+            this->name  = name;
+            this->start = now();
+        }
+    }
+
+    zone(const zone &) = delete;
+    auto operator= (const zone &) -> zone & = delete;
+
+    /**
+     *  @brief  End the zone and record it.
+     */
+    inline constexpr ~zone()
+    {
+        if consteval { return; }
+        else
+        {
+            if (!name) return;
+
+            auto duration = now() - start;
+            auto buffer   = this_thread;
+            auto size     = buffer->size.load(std::memory_order_relaxed);
+            if (size == buffer_capacity)
+            {
+                buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            buffer->events[size] = event { name, start, duration };
+            buffer->size.store(size + 1, std::memory_order_release);
+        }
+    }
+
+    /**
+     *  @brief   Get the current time.
+     *  @return  Nanoseconds of @c std::chrono::steady_clock .
+     */
+    [[nodiscard]] static inline auto now() -> std::int64_t
+    {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+};
+
+} // namespace trace
+
+} // namespace alcelin
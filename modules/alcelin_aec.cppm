@@ -0,0 +1,125 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Module partition of ANSI Escape Codes.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+module;
+
+#include <format>
+
+#include "alcelin_ansi_escape_codes.hpp"
+
+export module alcelin:aec;
+
+/**
+ *  @brief  ANSI Escape Codes.
+ */
+export namespace alcelin::aec {
+using alcelin::aec::csi;
+using alcelin::aec::sgr;
+using alcelin::aec::aec_t;
+using alcelin::aec::combine;
+using alcelin::aec::reset;
+using alcelin::aec::bold;
+using alcelin::aec::faint;
+using alcelin::aec::italic;
+using alcelin::aec::underline;
+using alcelin::aec::blink;
+using alcelin::aec::reverse_video;
+using alcelin::aec::strike;
+using alcelin::aec::black;
+using alcelin::aec::red;
+using alcelin::aec::green;
+using alcelin::aec::yellow;
+using alcelin::aec::blue;
+using alcelin::aec::magenta;
+using alcelin::aec::cyan;
+using alcelin::aec::white;
+using alcelin::aec::gray;
+using alcelin::aec::bright_red;
+using alcelin::aec::bright_green;
+using alcelin::aec::bright_yellow;
+using alcelin::aec::bright_blue;
+using alcelin::aec::bright_magenta;
+using alcelin::aec::bright_cyan;
+using alcelin::aec::bright_white;
+using alcelin::aec::black_bg;
+using alcelin::aec::red_bg;
+using alcelin::aec::green_bg;
+using alcelin::aec::yellow_bg;
+using alcelin::aec::blue_bg;
+using alcelin::aec::magenta_bg;
+using alcelin::aec::cyan_bg;
+using alcelin::aec::white_bg;
+using alcelin::aec::gray_bg;
+using alcelin::aec::bright_red_bg;
+using alcelin::aec::bright_green_bg;
+using alcelin::aec::bright_yellow_bg;
+using alcelin::aec::bright_blue_bg;
+using alcelin::aec::bright_magenta_bg;
+using alcelin::aec::bright_cyan_bg;
+using alcelin::aec::bright_white_bg;
+using alcelin::aec::color;
+using alcelin::aec::color_bg;
+using alcelin::aec::cuu;
+using alcelin::aec::cud;
+using alcelin::aec::cuf;
+using alcelin::aec::cub;
+using alcelin::aec::cha;
+using alcelin::aec::cup;
+using alcelin::aec::clear_screen;
+using alcelin::aec::clear_line;
+using alcelin::aec::show_cursor;
+using alcelin::aec::hide_cursor;
+} // namespace alcelin::aec
+
+/**
+ *  @brief  ANSI Escape Codes, operators version.
+ */
+export namespace alcelin::aec_operators {
+using alcelin::aec_operators::operator<<;
+using alcelin::aec_operators::operator+;
+using alcelin::aec_operators::operator*;
+using alcelin::aec_operators::operator&;
+using alcelin::aec_operators::operator|;
+using alcelin::aec_operators::operator&&;
+using alcelin::aec_operators::operator||;
+} // namespace alcelin::aec_operators
+
+// Keep the formatters reachable for importers, declarations in the global
+// module fragment are discarded unless named in the module
+using aec_formatter = std::formatter<alcelin::aec::aec_t>;
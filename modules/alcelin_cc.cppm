@@ -0,0 +1,74 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Module partition of Custom Containers.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+module;
+
+#include <format>
+
+#include "alcelin_custom_containers.hpp"
+
+export module alcelin:cc;
+
+/**
+ *  @brief  Custom Containers.
+ */
+export namespace alcelin::cc {
+using alcelin::cc::boundless_accessible;
+using alcelin::cc::boundless_access;
+using alcelin::cc::boundless_vector;
+using alcelin::cc::boundless_array;
+using alcelin::cc::boundless_span;
+using alcelin::cc::boundless_basic_string;
+using alcelin::cc::boundless_basic_string_view;
+using alcelin::cc::boundless_string;
+using alcelin::cc::boundless_wstring;
+using alcelin::cc::boundless_u16string;
+using alcelin::cc::boundless_u32string;
+using alcelin::cc::boundless_string_view;
+using alcelin::cc::boundless_wstring_view;
+using alcelin::cc::boundless_u16string_view;
+using alcelin::cc::boundless_u32string_view;
+using alcelin::cc::enumerated_array;
+using alcelin::cc::erray;
+} // namespace alcelin::cc
+
+// Keep the formatters reachable for importers, declarations in the global
+// module fragment are discarded unless named in the module
+using cc_formatter_1 = std::formatter<alcelin::cc::boundless_string>;
+using cc_formatter_2 = std::formatter<alcelin::cc::boundless_string_view>;
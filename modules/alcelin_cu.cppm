@@ -0,0 +1,94 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Module partition of Container Utilities.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+module;
+
+#include "alcelin_container_utilities.hpp"
+
+export module alcelin:cu;
+
+/**
+ *  @brief  Container Utilities.
+ */
+export namespace alcelin::cu {
+using alcelin::cu::cu_compatible;
+using alcelin::cu::value_type;
+using alcelin::cu::result_container;
+using alcelin::cu::result_container_nested;
+using alcelin::cu::cu_compatible_nested;
+using alcelin::cu::cu_compatible_enum;
+using alcelin::cu::enum_max;
+using alcelin::cu::enum_max_v;
+using alcelin::cu::slice;
+using alcelin::cu::subordinate;
+using alcelin::cu::combine;
+using alcelin::cu::filter_out_seq;
+using alcelin::cu::filter_strategy;
+using alcelin::cu::to_string;
+using alcelin::cu::filter_linear_max;
+using alcelin::cu::filter_out_occ;
+using alcelin::cu::filter_out_occ_seq;
+using alcelin::cu::filter_out;
+using alcelin::cu::repeat;
+using alcelin::cu::split_seq;
+using alcelin::cu::split_occ;
+using alcelin::cu::split_occ_seq;
+using alcelin::cu::split;
+using alcelin::cu::split_result;
+using alcelin::cu::make_split_result;
+using alcelin::cu::split_seq_flat;
+using alcelin::cu::split_occ_flat;
+using alcelin::cu::split_occ_seq_flat;
+using alcelin::cu::split_flat;
+using alcelin::cu::replace_seq;
+using alcelin::cu::replace_occ;
+} // namespace alcelin::cu
+
+/**
+ *  @brief  Container Utilities, operators version.
+ */
+export namespace alcelin::cu_operators {
+using alcelin::cu_operators::operator+;
+using alcelin::cu_operators::operator-;
+using alcelin::cu_operators::operator*;
+using alcelin::cu_operators::operator/;
+using alcelin::cu_operators::operator+=;
+using alcelin::cu_operators::operator-=;
+using alcelin::cu_operators::operator*=;
+} // namespace alcelin::cu_operators
@@ -0,0 +1,83 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Module partition of Properties.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+module;
+
+#include "alcelin_property.hpp"
+
+export module alcelin:prop;
+
+/**
+ *  @brief  Properties.
+ */
+export namespace alcelin::prop {
+using alcelin::prop::inplace_function_capacity;
+using alcelin::prop::inplace_function;
+using alcelin::prop::default_getter;
+using alcelin::prop::default_setter;
+using alcelin::prop::property_readonly_operators;
+using alcelin::prop::property_operators;
+using alcelin::prop::property_readonly;
+using alcelin::prop::mutation;
+using alcelin::prop::default_modifier;
+using alcelin::prop::no_modifier;
+using alcelin::prop::property;
+using alcelin::prop::connection;
+using alcelin::prop::signal;
+using alcelin::prop::batch;
+using alcelin::prop::computed_base;
+using alcelin::prop::computed;
+using alcelin::prop::observable;
+using alcelin::prop::proxy;
+using alcelin::prop::change_kind;
+using alcelin::prop::to_string;
+using alcelin::prop::vector_change;
+using alcelin::prop::observable_vector;
+using alcelin::prop::map_change;
+using alcelin::prop::observable_map;
+using alcelin::prop::executor;
+using alcelin::prop::task_queue;
+using alcelin::prop::seqlock;
+using alcelin::prop::atomic_observable;
+using alcelin::prop::registry_entry;
+using alcelin::prop::string_hash;
+using alcelin::prop::registry;
+using alcelin::prop::journal_target;
+using alcelin::prop::journal;
+} // namespace alcelin::prop
@@ -0,0 +1,101 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Module partition of String Manipulators.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+module;
+
+#include <format>
+#include <vector>
+
+#include "alcelin_string_manipulators.hpp"
+
+export module alcelin:sm;
+
+/**
+ *  @brief  String Manipulators.
+ */
+export namespace alcelin::sm {
+using alcelin::sm::sm_compatible;
+using alcelin::sm::result_string_nested;
+using alcelin::sm::split_result;
+using alcelin::sm::to_string;
+using alcelin::sm::chars_to_string;
+using alcelin::sm::word_wrap;
+using alcelin::sm::trim_dispatch_min;
+using alcelin::sm::trim_left;
+using alcelin::sm::trim_right;
+using alcelin::sm::trim;
+using alcelin::sm::to_upper;
+using alcelin::sm::to_lower;
+using alcelin::sm::is_equal_ins;
+using alcelin::sm::filter_out_seq;
+using alcelin::sm::filter_out_occ;
+using alcelin::sm::filter_out_occ_seq;
+using alcelin::sm::filter_out;
+using alcelin::sm::repeat;
+using alcelin::sm::split_seq;
+using alcelin::sm::split_occ;
+using alcelin::sm::split_occ_seq;
+using alcelin::sm::split;
+using alcelin::sm::split_seq_flat;
+using alcelin::sm::split_occ_flat;
+using alcelin::sm::split_occ_seq_flat;
+using alcelin::sm::split_flat;
+using alcelin::sm::replace;
+using alcelin::sm::replace_all;
+using alcelin::sm::replace_table;
+using alcelin::sm::fixed_string;
+using alcelin::sm::static_split_seq;
+using alcelin::sm::static_split_occ;
+using alcelin::sm::static_split;
+} // namespace alcelin::sm
+
+/**
+ *  @brief  String Manipulators, operators version.
+ */
+export namespace alcelin::sm_operators {
+using alcelin::sm_operators::operator-;
+using alcelin::sm_operators::operator*;
+using alcelin::sm_operators::operator/;
+using alcelin::sm_operators::operator-=;
+using alcelin::sm_operators::operator*=;
+} // namespace alcelin::sm_operators
+
+// Keep the formatters reachable for importers, declarations in the global
+// module fragment are discarded unless named in the module
+using sm_formatter = std::formatter<std::vector<int>>;
@@ -37,3 +37,284 @@
  *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
  *    "Standard".
  */
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <cstdint>
+#include <deque>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "alcelin_allocation_counters.hpp"
+#include "alcelin_trace.hpp"
+
+namespace alcelin::ac {
+
+/**
+ *  @brief  Every function's counters.
+ */
+struct counters_registry {
+
+    /**
+     *  @brief  Guards @c counters and @c indices .
+     */
+    std::mutex mutex;
+
+    /**
+     *  @brief  Counters, deque keeps the references stable.
+     */
+    std::deque<function_counters> counters;
+
+    /**
+     *  @brief  Counters by function name.
+     */
+    std::unordered_map<std::string_view, function_counters *> indices;
+};
+
+/**
+ *  @brief   Get the registry, created on first use so that counters can be
+ *           requested during static initialization.
+ *
+ *  @return  The registry.
+ */
+[[nodiscard]] static auto registry() -> counters_registry &
+{
+    static counters_registry instance;
+    return instance;
+}
+
+/**
+ *  @brief   Copy the live counters.
+ *
+ *  @param   counters  Live counters.
+ *  @return  Counters at this time.
+ */
+[[nodiscard]] static auto to_report(const function_counters &counters)
+    -> function_report
+{
+    return function_report {
+        .function    = counters.function,
+        .calls       = counters.calls.load(std::memory_order_relaxed),
+        .allocations = counters.allocations.load(std::memory_order_relaxed),
+        .bytes       = counters.bytes.load(std::memory_order_relaxed)
+    };
+}
+
+auto counters_for(std::string_view function) -> function_counters &
+{
+    // The registry's own allocations are not made by the counted function
+    suspend suspended;
+    auto   &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    auto it = instance.indices.find(function);
+    if (it != instance.indices.end()) return *it->second;
+
+    auto &counters = instance.counters.emplace_back();
+    counters.function = function;
+    instance.indices.emplace(function, &counters);
+    return counters;
+}
+
+auto report() -> std::vector<function_report>
+{
+    std::vector<function_report> reports = {};
+    auto &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    for (auto &counters : instance.counters)
+    {
+        auto current = to_report(counters);
+        if (current.calls != 0) reports.emplace_back(current);
+    }
+
+    std::ranges::stable_sort(reports, std::ranges::greater(),
+        &function_report::bytes);
+    return reports;
+}
+
+auto find(std::string_view function) -> std::optional<function_report>
+{
+    auto &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    auto it = instance.indices.find(function);
+    if (it == instance.indices.end()) return std::nullopt;
+
+    auto current = to_report(*it->second);
+    if (current.calls == 0) return std::nullopt;
+    return current;
+}
+
+auto reset() -> void
+{
+    auto &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    for (auto &counters : instance.counters)
+    {
+        counters.calls.store(0, std::memory_order_relaxed);
+        counters.allocations.store(0, std::memory_order_relaxed);
+        counters.bytes.store(0, std::memory_order_relaxed);
+    }
+}
+
+} // namespace alcelin::ac
+
+namespace alcelin::trace {
+
+/**
+ *  @brief  Every thread's buffer.
+ */
+struct buffers_registry {
+
+    /**
+     *  @brief  Guards @c buffers .
+     */
+    std::mutex mutex;
+
+    /**
+     *  @brief  Buffers in order of registration.
+     */
+    std::vector<std::unique_ptr<thread_buffer>> buffers;
+};
+
+/**
+ *  @brief   Get the registry, created on first use.
+ *  @return  The registry.
+ */
+[[nodiscard]] static auto registry() -> buffers_registry &
+{
+    static buffers_registry instance;
+    return instance;
+}
+
+/**
+ *  @brief   Escape a string for JSON.
+ *
+ *  Quotes, backslashes and control characters are escaped, the other bytes
+ *  are copied as is.
+ *
+ *  @param   string  String to escape.
+ *  @return  Escaped string without the quotes.
+ */
+[[nodiscard]] static auto json_escape(std::string_view string) -> std::string
+{
+    std::string escaped = {};
+    escaped.reserve(string.size());
+    for (char character : string)
+    {
+        switch (character)
+        {
+            case '"': escaped += "\\\""; break;
+            case '\\': escaped += "\\\\"; break;
+            case '\b': escaped += "\\b"; break;
+            case '\f': escaped += "\\f"; break;
+            case '\n': escaped += "\\n"; break;
+            case '\r': escaped += "\\r"; break;
+            case '\t': escaped += "\\t"; break;
+            default:
+                if ((unsigned char)character < 0x20)
+                {
+                    escaped += std::format("\\u{:04x}",
+                        (unsigned char)character);
+                }
+                else escaped += character;
+                break;
+        }
+    }
+    return escaped;
+}
+
+auto register_thread() -> thread_buffer *
+{
+    // Not an allocation of the traced function
+    ac::suspend suspended;
+    auto       &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    auto &buffer = instance.buffers.emplace_back(
+        std::make_unique<thread_buffer>());
+    buffer->thread = instance.buffers.size() - 1;
+    this_thread    = buffer.get();
+    return this_thread;
+}
+
+auto clear() -> void
+{
+    auto &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    for (auto &buffer : instance.buffers)
+    {
+        buffer->size.store(0, std::memory_order_relaxed);
+        buffer->dropped.store(0, std::memory_order_relaxed);
+    }
+}
+
+auto dropped() -> std::size_t
+{
+    auto &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    std::size_t count = 0;
+    for (auto &buffer : instance.buffers)
+    {
+        count += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    return count;
+}
+
+auto write_chrome_json(std::ostream &output) -> std::size_t
+{
+    auto &instance = registry();
+    std::scoped_lock lock(instance.mutex);
+
+    // Timestamps relative to the earliest zone, in microseconds
+    std::int64_t origin = INT64_MAX;
+    for (auto &buffer : instance.buffers)
+    {
+        auto size = buffer->size.load(std::memory_order_acquire);
+        for (std::size_t i = 0; i < size; i++)
+        {
+            origin = std::min(origin, buffer->events[i].start);
+        }
+    }
+
+    std::size_t written = 0;
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    for (auto &buffer : instance.buffers)
+    {
+        auto size = buffer->size.load(std::memory_order_acquire);
+        if (size == 0) continue;
+
+        output << std::format("{}\n{{\"name\":\"thread_name\",\"ph\":\"M\","
+            "\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"Thread {}\"}}}}",
+            written ? "," : "", buffer->thread, buffer->thread);
+
+        for (std::size_t i = 0; i < size; i++)
+        {
+            auto &current = buffer->events[i];
+            output << std::format(",\n{{\"name\":\"{}\",\"cat\":\"alcelin\","
+                "\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,"
+                "\"tid\":{}}}", json_escape(current.name),
+                (current.start - origin) / 1000.0, current.duration / 1000.0,
+                buffer->thread);
+            written++;
+        }
+    }
+    output << "\n]}\n";
+
+    return written;
+}
+
+} // namespace alcelin::trace
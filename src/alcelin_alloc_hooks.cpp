@@ -0,0 +1,91 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Counting global allocation functions for Allocation Counters.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#include "alcelin_allocation_counters.hpp"
+
+// Linked only into programs opting in through the alcelin_alloc_hooks target,
+// as a program can replace the global allocation functions only once.
+// Programs replacing them themselves call alcelin::ac::record_allocation from
+// their own operator new instead.
+
+/**
+ *  @brief   Allocate memory, counting the allocation.
+ *
+ *  Calls the new handler and retries while allocation fails, as the default
+ *  @c operator @c new does.
+ *
+ *  @param   size  Number of bytes to allocate.
+ *  @return  Allocated memory.
+ */
+auto operator new (std::size_t size) -> void *
+{
+    alcelin::ac::record_allocation(size);
+
+    if (size == 0) size = 1;
+    while (true)
+    {
+        if (void *memory = std::malloc(size)) return memory;
+
+        std::new_handler handler = std::get_new_handler();
+        if (!handler) throw std::bad_alloc();
+        handler();
+    }
+}
+
+/**
+ *  @brief  Free memory allocated by @c operator new .
+ *  @param  memory  Memory to free.
+ */
+auto operator delete (void *memory) noexcept -> void
+{
+    std::free(memory);
+}
+
+/**
+ *  @brief  Free memory allocated by @c operator new .
+ *  @param  memory  Memory to free.
+ */
+auto operator delete (void *memory, std::size_t) noexcept -> void
+{
+    std::free(memory);
+}
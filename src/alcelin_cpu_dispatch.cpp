@@ -0,0 +1,911 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Runtime CPU feature dispatch of Alcelin's kernels.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string_view>
+
+#include "alcelin_cpu_dispatch.hpp"
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define ALCELIN_CPU_X86
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define ALCELIN_CPU_TARGET(isa)
+#else
+#include <cpuid.h>
+#define ALCELIN_CPU_TARGET(isa) [[gnu::target(isa)]]
+#endif
+#endif
+
+namespace alcelin::cpu {
+
+/**
+ *  @brief  Byte set for the baseline kernels.
+ */
+struct byte_set {
+
+    /**
+     *  @brief  Whether each byte is in the set.
+     */
+    std::array<bool, 256> contains = {};
+
+    /**
+     *  @brief  Make a byte set.
+     *
+     *  @param  set       Bytes in the set.
+     *  @param  set_size  Number of bytes in the set.
+     */
+    byte_set(const char *set, std::size_t set_size)
+    {
+        for (std::size_t i = 0; i < set_size; i++)
+        {
+            contains[(unsigned char)set[i]] = true;
+        }
+    }
+
+    /**
+     *  @brief   Check whether the byte is in the set.
+     *
+     *  @param   c  Byte to check.
+     *  @return  True if the byte is in the set.
+     */
+    [[nodiscard]] auto operator()(char c) const -> bool
+    {
+        return contains[(unsigned char)c];
+    }
+};
+
+/**
+ *  @brief  CRC-32C (Castagnoli) table of the reflected polynomial.
+ */
+static constexpr auto crc32c_table = []() {
+    std::array<std::uint32_t, 256> table = {};
+    for (std::uint32_t i = 0; i < 256; i++)
+    {
+        std::uint32_t crc = i;
+        for (int bit = 0; bit < 8; bit++)
+        {
+            crc = crc & 1 ? crc >> 1 ^ 0x82F63B78 : crc >> 1;
+        }
+        table[i] = crc;
+    }
+    return table;
+}();
+
+/**
+ *  @brief  Kernels without any instruction set extension, used by the other
+ *          kernels for the cases they do not handle.
+ */
+namespace baseline {
+
+static auto find_first_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    byte_set in_set(set, set_size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (in_set(data[i])) return i;
+    }
+    return std::string_view::npos;
+}
+
+static auto find_first_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    byte_set in_set(set, set_size);
+    for (std::size_t i = 0; i < size; i++)
+    {
+        if (!in_set(data[i])) return i;
+    }
+    return std::string_view::npos;
+}
+
+static auto find_last_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    byte_set in_set(set, set_size);
+    for (std::size_t i = size; i > 0; i--)
+    {
+        if (!in_set(data[i - 1])) return i - 1;
+    }
+    return std::string_view::npos;
+}
+
+static auto to_lower(char *output, const char *input, std::size_t size)
+    -> void
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        char c    = input[i];
+        output[i] = c >= 'A' && c <= 'Z' ? c | 0x20 : c;
+    }
+}
+
+static auto to_upper(char *output, const char *input, std::size_t size)
+    -> void
+{
+    for (std::size_t i = 0; i < size; i++)
+    {
+        char c    = input[i];
+        output[i] = c >= 'a' && c <= 'z' ? c & ~0x20 : c;
+    }
+}
+
+static auto crc32c(std::uint32_t crc, const void *data, std::size_t size)
+    -> std::uint32_t
+{
+    auto bytes = (const unsigned char *)data;
+
+    crc = ~crc;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        crc = crc >> 8 ^ crc32c_table[(crc ^ bytes[i]) & 0xFF];
+    }
+    return ~crc;
+}
+
+/**
+ *  @brief  Baseline kernels.
+ */
+static constexpr kernel_table table = {
+    .level             = isa::baseline,
+    .find_first_of     = find_first_of,
+    .find_first_not_of = find_first_not_of,
+    .find_last_not_of  = find_last_not_of,
+    .to_lower          = to_lower,
+    .to_upper          = to_upper,
+    .crc32c            = crc32c
+};
+
+} // namespace baseline
+
+#ifdef ALCELIN_CPU_X86
+
+/**
+ *  @brief  SSE4.2 kernels, the string instructions compare against up to 16
+ *          bytes of set at once.
+ */
+namespace sse42 {
+
+/**
+ *  @brief  Bytes in a register.
+ */
+inline constexpr std::size_t width = 16;
+
+/**
+ *  @brief  Find modes for @c find .
+ */
+inline constexpr int first_of     = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY
+                                  | _SIDD_LEAST_SIGNIFICANT;
+inline constexpr int first_not_of = first_of | _SIDD_MASKED_NEGATIVE_POLARITY;
+inline constexpr int last_not_of  = _SIDD_UBYTE_OPS | _SIDD_CMP_EQUAL_ANY
+                                  | _SIDD_MASKED_NEGATIVE_POLARITY
+                                  | _SIDD_MOST_SIGNIFICANT;
+
+/**
+ *  @brief   Load up to a register of bytes without reading past them.
+ *
+ *  @param   data  Bytes.
+ *  @param   size  Number of bytes, at most @c width .
+ *  @return  Register with the bytes, zero after them.
+ */
+ALCELIN_CPU_TARGET("sse4.2")
+static auto load_partial(const char *data, std::size_t size) -> __m128i
+{
+    alignas(16) char buffer[width] = {};
+    std::memcpy(buffer, data, size);
+    return _mm_load_si128((const __m128i *)buffer);
+}
+
+/**
+ *  @brief   Find forwards with the string instructions.
+ *
+ *  @tparam  mode      @c first_of or @c first_not_of .
+ *  @param   data      Bytes to search.
+ *  @param   size      Number of bytes.
+ *  @param   set       Set, at most @c width bytes.
+ *  @param   set_size  Number of bytes in the set.
+ *  @return  Position, or @c std::string_view::npos .
+ */
+template<int mode>
+ALCELIN_CPU_TARGET("sse4.2")
+static auto find_forward(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    __m128i needles    = load_partial(set, set_size);
+    int     set_length = (int)set_size;
+
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(data + i));
+        int     index = _mm_cmpestri(needles, set_length, block, (int)width,
+            mode);
+        if (index != (int)width) return i + index;
+    }
+
+    if (i == size) return std::string_view::npos;
+
+    __m128i block = load_partial(data + i, size - i);
+    int     index = _mm_cmpestri(needles, set_length, block, (int)(size - i),
+        mode);
+    return index != (int)width ? i + index : std::string_view::npos;
+}
+
+ALCELIN_CPU_TARGET("sse4.2")
+static auto find_first_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > width)
+    {
+        return baseline::find_first_of(data, size, set, set_size);
+    }
+    return find_forward<first_of>(data, size, set, set_size);
+}
+
+ALCELIN_CPU_TARGET("sse4.2")
+static auto find_first_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > width)
+    {
+        return baseline::find_first_not_of(data, size, set, set_size);
+    }
+    return find_forward<first_not_of>(data, size, set, set_size);
+}
+
+ALCELIN_CPU_TARGET("sse4.2")
+static auto find_last_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > width)
+    {
+        return baseline::find_last_not_of(data, size, set, set_size);
+    }
+
+    __m128i needles    = load_partial(set, set_size);
+    int     set_length = (int)set_size;
+
+    std::size_t end = size;
+    for (; end >= width; end -= width)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(data + end - width));
+        int     index = _mm_cmpestri(needles, set_length, block, (int)width,
+            last_not_of);
+        if (index != (int)width) return end - width + index;
+    }
+
+    if (end == 0) return std::string_view::npos;
+
+    __m128i block = load_partial(data, end);
+    int     index = _mm_cmpestri(needles, set_length, block, (int)end,
+        last_not_of);
+    return index != (int)width ? (std::size_t)index : std::string_view::npos;
+}
+
+/**
+ *  @brief   Flip the case bit of the letters in a range.
+ *
+ *  @param   block  Bytes.
+ *  @param   first  First letter of the range.
+ *  @param   last   Last letter of the range.
+ *  @return  Bytes with the letters' case flipped.
+ */
+ALCELIN_CPU_TARGET("sse4.2")
+static auto flip_case(__m128i block, char first, char last) -> __m128i
+{
+    // Bytes above 127 are negative and thus never in the range
+    __m128i above = _mm_cmpgt_epi8(block, _mm_set1_epi8((char)(first - 1)));
+    __m128i below = _mm_cmplt_epi8(block, _mm_set1_epi8((char)(last + 1)));
+    __m128i flip  = _mm_and_si128(_mm_and_si128(above, below),
+        _mm_set1_epi8(0x20));
+    return _mm_xor_si128(block, flip);
+}
+
+ALCELIN_CPU_TARGET("sse4.2")
+static auto to_lower(char *output, const char *input, std::size_t size)
+    -> void
+{
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(input + i));
+        _mm_storeu_si128((__m128i *)(output + i), flip_case(block, 'A', 'Z'));
+    }
+    baseline::to_lower(output + i, input + i, size - i);
+}
+
+ALCELIN_CPU_TARGET("sse4.2")
+static auto to_upper(char *output, const char *input, std::size_t size)
+    -> void
+{
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m128i block = _mm_loadu_si128((const __m128i *)(input + i));
+        _mm_storeu_si128((__m128i *)(output + i), flip_case(block, 'a', 'z'));
+    }
+    baseline::to_upper(output + i, input + i, size - i);
+}
+
+ALCELIN_CPU_TARGET("sse4.2")
+static auto crc32c(std::uint32_t crc, const void *data, std::size_t size)
+    -> std::uint32_t
+{
+    auto          bytes = (const unsigned char *)data;
+    std::uint64_t value = ~crc;
+
+    std::size_t i = 0;
+    for (; i + 8 <= size; i += 8)
+    {
+        std::uint64_t word;
+        std::memcpy(&word, bytes + i, 8);
+        value = _mm_crc32_u64(value, word);
+    }
+
+    auto result = (std::uint32_t)value;
+    for (; i < size; i++) result = _mm_crc32_u8(result, bytes[i]);
+    return ~result;
+}
+
+/**
+ *  @brief  SSE4.2 kernels.
+ */
+static constexpr kernel_table table = {
+    .level             = isa::sse42,
+    .find_first_of     = find_first_of,
+    .find_first_not_of = find_first_not_of,
+    .find_last_not_of  = find_last_not_of,
+    .to_lower          = to_lower,
+    .to_upper          = to_upper,
+    .crc32c            = crc32c
+};
+
+} // namespace sse42
+
+/**
+ *  @brief  AVX2 kernels, comparing a register of data against each byte of
+ *          the set.
+ */
+namespace avx2 {
+
+/**
+ *  @brief  Bytes in a register.
+ */
+inline constexpr std::size_t width = 32;
+
+/**
+ *  @brief  Largest set compared a byte at a time, the SSE4.2 kernels handle
+ *          the larger sets up to their limit.
+ */
+inline constexpr std::size_t max_set = 8;
+
+/**
+ *  @brief   Get the mask of bytes in the set.
+ *
+ *  @param   block     Bytes.
+ *  @param   set       Set, at most @c max_set bytes.
+ *  @param   set_size  Number of bytes in the set.
+ *  @return  Bit per byte, set if the byte is in the set.
+ */
+ALCELIN_CPU_TARGET("avx2")
+static auto in_set(__m256i block, const char *set, std::size_t set_size)
+    -> std::uint32_t
+{
+    __m256i matches = _mm256_setzero_si256();
+    for (std::size_t i = 0; i < set_size; i++)
+    {
+        matches = _mm256_or_si256(matches,
+            _mm256_cmpeq_epi8(block, _mm256_set1_epi8(set[i])));
+    }
+    return (std::uint32_t)_mm256_movemask_epi8(matches);
+}
+
+ALCELIN_CPU_TARGET("avx2")
+static auto find_first_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > max_set)
+    {
+        return sse42::find_first_of(data, size, set, set_size);
+    }
+
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(data + i));
+        if (auto mask = in_set(block, set, set_size); mask != 0)
+        {
+            return i + std::countr_zero(mask);
+        }
+    }
+
+    auto pos = sse42::find_first_of(data + i, size - i, set, set_size);
+    return pos == std::string_view::npos ? pos : i + pos;
+}
+
+ALCELIN_CPU_TARGET("avx2")
+static auto find_first_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > max_set)
+    {
+        return sse42::find_first_not_of(data, size, set, set_size);
+    }
+
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(data + i));
+        if (auto mask = ~in_set(block, set, set_size); mask != 0)
+        {
+            return i + std::countr_zero(mask);
+        }
+    }
+
+    auto pos = sse42::find_first_not_of(data + i, size - i, set, set_size);
+    return pos == std::string_view::npos ? pos : i + pos;
+}
+
+ALCELIN_CPU_TARGET("avx2")
+static auto find_last_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > max_set)
+    {
+        return sse42::find_last_not_of(data, size, set, set_size);
+    }
+
+    std::size_t end = size;
+    for (; end >= width; end -= width)
+    {
+        auto    from  = (const __m256i *)(data + end - width);
+        __m256i block = _mm256_loadu_si256(from);
+        if (auto mask = ~in_set(block, set, set_size); mask != 0)
+        {
+            return end - 1 - std::countl_zero(mask);
+        }
+    }
+
+    return sse42::find_last_not_of(data, end, set, set_size);
+}
+
+/**
+ *  @brief   Flip the case bit of the letters in a range.
+ *
+ *  @param   block  Bytes.
+ *  @param   first  First letter of the range.
+ *  @param   last   Last letter of the range.
+ *  @return  Bytes with the letters' case flipped.
+ */
+ALCELIN_CPU_TARGET("avx2")
+static auto flip_case(__m256i block, char first, char last) -> __m256i
+{
+    __m256i above = _mm256_cmpgt_epi8(block,
+        _mm256_set1_epi8((char)(first - 1)));
+    __m256i below = _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(last + 1)),
+        block);
+    __m256i flip  = _mm256_and_si256(_mm256_and_si256(above, below),
+        _mm256_set1_epi8(0x20));
+    return _mm256_xor_si256(block, flip);
+}
+
+ALCELIN_CPU_TARGET("avx2")
+static auto to_lower(char *output, const char *input, std::size_t size)
+    -> void
+{
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(input + i));
+        _mm256_storeu_si256((__m256i *)(output + i),
+            flip_case(block, 'A', 'Z'));
+    }
+    sse42::to_lower(output + i, input + i, size - i);
+}
+
+ALCELIN_CPU_TARGET("avx2")
+static auto to_upper(char *output, const char *input, std::size_t size)
+    -> void
+{
+    std::size_t i = 0;
+    for (; i + width <= size; i += width)
+    {
+        __m256i block = _mm256_loadu_si256((const __m256i *)(input + i));
+        _mm256_storeu_si256((__m256i *)(output + i),
+            flip_case(block, 'a', 'z'));
+    }
+    sse42::to_upper(output + i, input + i, size - i);
+}
+
+/**
+ *  @brief  AVX2 kernels, the checksum has no wider instruction.
+ */
+static constexpr kernel_table table = {
+    .level             = isa::avx2,
+    .find_first_of     = find_first_of,
+    .find_first_not_of = find_first_not_of,
+    .find_last_not_of  = find_last_not_of,
+    .to_lower          = to_lower,
+    .to_upper          = to_upper,
+    .crc32c            = sse42::crc32c
+};
+
+} // namespace avx2
+
+/**
+ *  @brief  AVX-512 kernels, masked loads and stores handle the tails.
+ */
+namespace avx512 {
+
+/**
+ *  @brief  Bytes in a register.
+ */
+inline constexpr std::size_t width = 64;
+
+/**
+ *  @brief   Load up to a register of bytes, masked loads do not fault past
+ *           them.
+ *
+ *  @param   data  Bytes.
+ *  @param   size  Number of bytes, at most @c width .
+ *  @return  Register with the bytes, zero after them.
+ */
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto load_partial(const char *data, std::size_t size) -> __m512i
+{
+    return _mm512_maskz_loadu_epi8(_bzhi_u64(~0ULL, (unsigned)size), data);
+}
+
+/**
+ *  @brief   Get the mask of bytes in the set.
+ *
+ *  @param   block     Bytes.
+ *  @param   set       Set, at most @c avx2::max_set bytes.
+ *  @param   set_size  Number of bytes in the set.
+ *  @return  Bit per byte, set if the byte is in the set.
+ */
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto in_set(__m512i block, const char *set, std::size_t set_size)
+    -> std::uint64_t
+{
+    __mmask64 matches = 0;
+    for (std::size_t i = 0; i < set_size; i++)
+    {
+        matches |= _mm512_cmpeq_epi8_mask(block, _mm512_set1_epi8(set[i]));
+    }
+    return matches;
+}
+
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto find_first_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > avx2::max_set)
+    {
+        return sse42::find_first_of(data, size, set, set_size);
+    }
+
+    for (std::size_t i = 0; i < size; i += width)
+    {
+        auto count = std::min(width, size - i);
+        auto valid = _bzhi_u64(~0ULL, (unsigned)count);
+        auto mask  = in_set(load_partial(data + i, count), set, set_size);
+        if (mask & valid) return i + std::countr_zero(mask & valid);
+    }
+    return std::string_view::npos;
+}
+
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto find_first_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > avx2::max_set)
+    {
+        return sse42::find_first_not_of(data, size, set, set_size);
+    }
+
+    for (std::size_t i = 0; i < size; i += width)
+    {
+        auto count = std::min(width, size - i);
+        auto valid = _bzhi_u64(~0ULL, (unsigned)count);
+        auto mask  = ~in_set(load_partial(data + i, count), set, set_size);
+        if (mask & valid) return i + std::countr_zero(mask & valid);
+    }
+    return std::string_view::npos;
+}
+
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto find_last_not_of(
+    const char *data,
+    std::size_t size,
+    const char *set,
+    std::size_t set_size
+) -> std::size_t
+{
+    if (set_size > avx2::max_set)
+    {
+        return sse42::find_last_not_of(data, size, set, set_size);
+    }
+
+    for (std::size_t end = size; end > 0;)
+    {
+        auto count = std::min(width, end);
+        auto valid = _bzhi_u64(~0ULL, (unsigned)count);
+        auto mask  = ~in_set(load_partial(data + end - count, count), set,
+            set_size);
+        if (mask & valid)
+        {
+            return end - count + 63 - std::countl_zero(mask & valid);
+        }
+        end -= count;
+    }
+    return std::string_view::npos;
+}
+
+/**
+ *  @brief  Flip the case bit of the letters in a range.
+ *
+ *  @param  output  Output bytes.
+ *  @param  input   Input bytes.
+ *  @param  size    Number of bytes.
+ *  @param  first   First letter of the range.
+ */
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto flip_case(
+    char       *output,
+    const char *input,
+    std::size_t size,
+    char        first
+) -> void
+{
+    for (std::size_t i = 0; i < size; i += width)
+    {
+        auto    count = std::min(width, size - i);
+        auto    valid = _bzhi_u64(~0ULL, (unsigned)count);
+        __m512i block = load_partial(input + i, count);
+
+        // Letters are the 26 bytes from the first, unsigned
+        __mmask64 letters = _mm512_cmplt_epu8_mask(
+            _mm512_sub_epi8(block, _mm512_set1_epi8(first)),
+            _mm512_set1_epi8(26));
+        block = _mm512_xor_si512(block,
+            _mm512_maskz_mov_epi8(letters, _mm512_set1_epi8(0x20)));
+        _mm512_mask_storeu_epi8(output + i, valid, block);
+    }
+}
+
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto to_lower(char *output, const char *input, std::size_t size)
+    -> void
+{
+    flip_case(output, input, size, 'A');
+}
+
+ALCELIN_CPU_TARGET("avx512f,avx512bw,bmi2")
+static auto to_upper(char *output, const char *input, std::size_t size)
+    -> void
+{
+    flip_case(output, input, size, 'a');
+}
+
+/**
+ *  @brief  AVX-512 kernels, the checksum has no wider instruction.
+ */
+static constexpr kernel_table table = {
+    .level             = isa::avx512,
+    .find_first_of     = find_first_of,
+    .find_first_not_of = find_first_not_of,
+    .find_last_not_of  = find_last_not_of,
+    .to_lower          = to_lower,
+    .to_upper          = to_upper,
+    .crc32c            = sse42::crc32c
+};
+
+} // namespace avx512
+
+/**
+ *  @brief   Query CPUID.
+ *
+ *  @param   leaf     Leaf.
+ *  @param   subleaf  Subleaf.
+ *  @return  EAX, EBX, ECX and EDX, zero if the leaf is not supported.
+ */
+[[nodiscard]] static auto cpuid(unsigned leaf, unsigned subleaf)
+    -> std::array<unsigned, 4>
+{
+    std::array<unsigned, 4> registers = {};
+#if defined(_MSC_VER) && !defined(__clang__)
+    int values[4];
+    __cpuid(values, 0);
+    if ((unsigned)values[0] < leaf) return registers;
+    __cpuidex(values, (int)leaf, (int)subleaf);
+    std::memcpy(registers.data(), values, sizeof (values));
+#else
+    __get_cpuid_count(leaf, subleaf, &registers[0], &registers[1],
+        &registers[2], &registers[3]);
+#endif
+    return registers;
+}
+
+/**
+ *  @brief   Get the register states the OS saves, needs OSXSAVE.
+ *  @return  XCR0.
+ */
+[[nodiscard]] static auto xcr0() -> std::uint64_t
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    return _xgetbv(0);
+#else
+    unsigned eax, edx;
+    __asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (std::uint64_t)edx << 32 | eax;
+#endif
+}
+
+/**
+ *  @brief   Detect the instruction set with CPUID, the AVX ones also need the
+ *           OS to save their registers.
+ *
+ *  @return  Best instruction set.
+ */
+[[nodiscard]] static auto detect() -> isa
+{
+    auto [eax1, ebx1, ecx1, edx1] = cpuid(1, 0);
+    if (!(ecx1 & 1u << 20)) return isa::baseline;
+
+    bool osxsave = ecx1 & 1u << 27;
+    auto xcr     = osxsave ? xcr0() : 0;
+    if ((xcr & 0x6) != 0x6) return isa::sse42;
+
+    auto [eax7, ebx7, ecx7, edx7] = cpuid(7, 0);
+    if (!(ebx7 & 1u << 5)) return isa::sse42;
+
+    // AVX-512F, AVX-512BW and BMI2, with the opmask and ZMM registers
+    bool avx512 = (ebx7 & 1u << 16) && (ebx7 & 1u << 30) && (ebx7 & 1u << 8);
+    if (!avx512 || (xcr & 0xE0) != 0xE0) return isa::avx2;
+    return isa::avx512;
+}
+
+#else
+
+/**
+ *  @brief   Detect the instruction set, there are no kernels for others.
+ *  @return  Baseline.
+ */
+[[nodiscard]] static auto detect() -> isa
+{
+    return isa::baseline;
+}
+
+#endif
+
+auto detected() -> isa
+{
+    static const isa level = detect();
+    return level;
+}
+
+auto active() -> isa
+{
+    static const isa level = []() {
+        auto name = std::getenv("ALCELIN_ISA");
+        auto requested = name ? isa_from_name(name) : isa::unknown;
+        if (requested == isa::unknown) return detected();
+        return std::min(requested, detected());
+    }();
+    return level;
+}
+
+auto kernels_for(isa level) -> const kernel_table &
+{
+    switch (std::min(level, detected()))
+    {
+#ifdef ALCELIN_CPU_X86
+        case isa::avx512: return avx512::table;
+        case isa::avx2:   return avx2::table;
+        case isa::sse42:  return sse42::table;
+#endif
+        default:          return baseline::table;
+    }
+}
+
+auto kernels() -> const kernel_table &
+{
+    // Resolved once, then every call is an indirect call through the table
+    static const kernel_table &table = kernels_for(active());
+    return table;
+}
+
+} // namespace alcelin::cpu
@@ -0,0 +1,234 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Test all of Allocation Counters in Alcelin.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <exception>
+#include <limits>
+#include <new>
+#include <string_view>
+#include <vector>
+
+#include "confer.hpp"
+
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_allocation_counters.hpp"
+#include "alcelin_container_utilities.hpp"
+#include "alcelin_string_manipulators.hpp"
+#endif
+
+using namespace alcelin;
+using namespace std::string_view_literals;
+
+// Counted functions must still be usable in constant expressions
+static_assert(cu::subordinate(std::vector { 1, 2, 3 }, 0, 2).size() == 2);
+
+/**
+ *  @brief   Test AC's counters registry.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_ac_counters) {
+    CT_BEGIN;
+
+    auto &counters = ac::counters_for("test::counters");
+    auto &same     = ac::counters_for("test::counters");
+
+    CT_ASSERT(&counters, &same, "Same name must give same counters");
+    CT_ASSERT(counters.function, "test::counters"sv, "Name must be kept");
+    CT_ASSERT(ac::find("test::counters").has_value(), false,
+        "Never called function must not be reported");
+
+    {
+        // Volatile so the allocation cannot be elided
+        ac::scope            scope(&counters);
+        static int *volatile allocated = nullptr;
+        allocated = new int(21);
+        delete allocated;
+    }
+
+    auto report = ac::find("test::counters");
+    CT_ASSERT(report.has_value(), true, "Called function must be reported");
+    CT_ASSERT(report->calls, 1, "Scope must count a call");
+
+    if constexpr (ac::instrumented)
+    {
+        CT_ASSERT(report->allocations, 1, "Allocation must be counted");
+        CT_ASSERT(report->bytes, sizeof (int), "Bytes must be counted");
+    }
+    else
+    {
+        CT_ASSERT(report->allocations, 0, "Nothing is counted if not "
+            "instrumented");
+    }
+
+    ac::reset();
+    CT_ASSERT(ac::find("test::counters").has_value(), false,
+        "Reset function must not be reported");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test AC's counting of Alcelin's functions.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_ac_functions) {
+    CT_BEGIN;
+
+    ac::reset();
+    auto split = sm::split("Hello, World!", ',');
+    auto lines = sm::word_wrap("The quick brown fox", 5);
+
+    auto split_report = ac::find("sm::split");
+    auto cu_report    = ac::find("cu::split");
+    auto wrap_report  = ac::find("sm::word_wrap");
+
+    if constexpr (ac::instrumented)
+    {
+        CT_ASSERT(split_report.has_value(), true, "sm::split must be counted");
+        CT_ASSERT(split_report->calls, 1, "sm::split must be called once");
+        CT_ASSERT(split_report->allocations != 0, true,
+            "sm::split allocates");
+        CT_ASSERT(cu_report.has_value(), true, "Nested call must be counted");
+        CT_ASSERT(cu_report->bytes <= split_report->bytes, true,
+            "Nested allocations must be counted for the caller too");
+        CT_ASSERT(wrap_report->calls, 1, "sm::word_wrap must be called once");
+
+        auto report = ac::report();
+        for (std::size_t i = 1; i < report.size(); i++)
+        {
+            CT_ASSERT(report[i - 1].bytes >= report[i].bytes, true,
+                "Report must be sorted by bytes");
+        }
+    }
+    else
+    {
+        CT_ASSERT(split_report.has_value(), false, "Nothing is counted if "
+            "not instrumented");
+        CT_ASSERT(ac::report().empty(), true, "Report must be empty if not "
+            "instrumented");
+    }
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test that the counting allocation functions call the new handler.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_ac_new_handler) {
+    CT_BEGIN;
+
+    // Gives up after the first retry
+    static int handled = 0;
+    handled = 0;
+    std::set_new_handler([]() {
+        handled++;
+        std::set_new_handler(nullptr);
+    });
+
+    // Volatile so the impossible size is not diagnosed at compile time
+    volatile std::size_t size   = std::numeric_limits<std::size_t>::max() / 2;
+    bool                 thrown = false;
+    try
+    {
+        ::operator delete (::operator new (size));
+    }
+    catch (const std::bad_alloc &)
+    {
+        thrown = true;
+    }
+    std::set_new_handler(nullptr);
+
+    CT_ASSERT(handled, 1, "New handler must be called before giving up");
+    CT_ASSERT(thrown, true, "Failed allocation must throw std::bad_alloc");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test AC.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_ac) try
+{
+    test_case ac_counters_test_case {
+        .title         = "Test AC's counters registry",
+        .function_name = "test_ac_counters",
+        .function      = test_ac_counters
+    };
+
+    test_case ac_functions_test_case {
+        .title         = "Test AC's counting of Alcelin's functions",
+        .function_name = "test_ac_functions",
+        .function      = test_ac_functions
+    };
+
+    test_case ac_new_handler_test_case {
+        .title         = "Test that the counting allocation functions call the "
+                         "new handler",
+        .function_name = "test_ac_new_handler",
+        .function      = test_ac_new_handler
+    };
+
+    test_suite suite = {
+        .tests       = {
+            &ac_counters_test_case,
+            &ac_functions_test_case,
+            &ac_new_handler_test_case
+        },
+        .pre_run  = default_pre_runner('=', 3),
+        .post_run = default_post_runner('=', 3)
+    };
+
+    auto failed_tests = suite.run();
+    print_failed_tests(failed_tests);
+    return sum_failed_tests_errors(failed_tests);
+}
+catch (const std::exception &e)
+{
+    logln("Exception occurred during test: {}", e.what());
+    return 1;
+}
+catch (...)
+{
+    logln("Unknown exception occurred during test");
+    return 1;
+}
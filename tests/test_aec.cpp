@@ -40,9 +40,14 @@
 #include <iostream>
 #include <print>
 
-#include "alcelin_ansi_escape_codes.hpp"
 #include "confer.hpp"
 
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_ansi_escape_codes.hpp"
+#endif
+
 using namespace alcelin;
 using namespace aec_operators;
 
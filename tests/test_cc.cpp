@@ -37,11 +37,17 @@
  *    "Standard".
  */
 
+#include <cstddef>
 #include <vector>
 
-#include "alcelin_custom_containers.hpp"
 #include "confer.hpp"
 
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_custom_containers.hpp"
+#endif
+
 using namespace alcelin;
 
 /**
@@ -0,0 +1,342 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Test all of CPU Dispatch in Alcelin.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "confer.hpp"
+
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_cpu_dispatch.hpp"
+#include "alcelin_string_manipulators.hpp"
+#endif
+
+using namespace alcelin;
+using namespace std::string_view_literals;
+
+/**
+ *  @brief   Make bytes with runs of whitespace, letters, and bytes above 127.
+ *
+ *  @param   size  Number of bytes.
+ *  @param   seed  Seed, different seeds make different bytes.
+ *  @return  Bytes.
+ */
+[[nodiscard]] static auto make_bytes(std::size_t size, std::size_t seed)
+    -> std::string
+{
+    constexpr std::string_view alphabet = " \t\n  aZ,.z@[`{\0\x80\xFF"sv;
+
+    std::string   bytes;
+    std::uint32_t state = 2463534242u + (std::uint32_t)seed;
+    for (std::size_t i = 0; i < size; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        bytes += state % 4 == 0 ? (char)(state >> 8)
+                                : alphabet[state % alphabet.size()];
+    }
+    return bytes;
+}
+
+/**
+ *  @brief   Get the instruction sets the CPU supports.
+ *  @return  Supported instruction sets, in increasing order.
+ */
+[[nodiscard]] static auto supported_isas() -> std::vector<cpu::isa>
+{
+    std::vector<cpu::isa> isas;
+    for (int i = 0; i <= (int)cpu::detected(); i++)
+    {
+        isas.emplace_back((cpu::isa)i);
+    }
+    return isas;
+}
+
+/**
+ *  @brief   Test CPU's detection.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cpu_detection) {
+    CT_BEGIN;
+
+    logln("detected: {}", cpu::to_string(cpu::detected()));
+    logln("active: {}",   cpu::to_string(cpu::active()));
+
+    for (int i = 0; i < (int)cpu::isa::max; i++)
+    {
+        CT_ASSERT(cpu::isa_from_name(cpu::to_string((cpu::isa)i)), (cpu::isa)i,
+            "Names must round trip");
+    }
+    CT_ASSERT(cpu::isa_from_name("sse9"), cpu::isa::unknown,
+        "Unknown names must be unknown");
+
+    CT_ASSERT(cpu::active() <= cpu::detected(), true,
+        "Active instruction set must be supported");
+    CT_ASSERT(cpu::kernels().level, cpu::active(),
+        "Kernels must be of the active instruction set");
+    CT_ASSERT(cpu::kernels_for(cpu::isa::avx512).level, cpu::detected(),
+        "Unsupported instruction sets must use the detected one");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test CPU's search kernels against @c std::string_view .
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cpu_search) {
+    CT_BEGIN;
+
+    std::vector<std::string_view> sets = {
+        " \t\r\n\f\v\b", "", " ", "aZ", "\0"sv, "\x80\xFF", " \t\n,.@[`{aZz",
+        " \t\n,.@[`{aZz\0\x80\xFF!?"sv
+    };
+
+    for (auto level : supported_isas())
+    {
+        auto       &kernels    = cpu::kernels_for(level);
+        std::size_t mismatches = 0;
+
+        for (std::size_t size = 0; size < 200; size++)
+        {
+            // Offset by a byte to search unaligned data too
+            auto bytes = make_bytes(size + 1, size);
+            auto data  = std::string_view(bytes).substr(1);
+
+            for (auto set : sets)
+            {
+                auto first_of = kernels.find_first_of(data.data(),
+                    data.size(), set.data(), set.size());
+                auto first_not_of = kernels.find_first_not_of(data.data(),
+                    data.size(), set.data(), set.size());
+                auto last_not_of = kernels.find_last_not_of(data.data(),
+                    data.size(), set.data(), set.size());
+
+                mismatches += first_of != data.find_first_of(set);
+                mismatches += first_not_of != data.find_first_not_of(set);
+                mismatches += last_not_of != data.find_last_not_of(set);
+            }
+        }
+
+        logln("{}: {} mismatches", cpu::to_string(level), mismatches);
+        CT_ASSERT(mismatches, 0, "Kernels must find the same positions");
+    }
+
+    std::string padded = "  \t" + make_bytes(100, 0) + "\n  ";
+    CT_ASSERT(sm::trim(padded), std::string_view(padded).substr(3, 100),
+        "Trim must use the kernels");
+
+    // Runs of delimiters around the inline search's and the kernels' limit
+    std::size_t untrimmed = 0;
+    for (std::size_t run = 0; run < 2 * sm::trim_dispatch_min + 2; run++)
+    {
+        for (std::size_t size = 0; size < 4; size++)
+        {
+            std::string text   = std::string(size, 'x');
+            std::string spaces = std::string(run, ' ');
+            std::string left   = spaces + text;
+            std::string right  = text + spaces;
+
+            untrimmed += sm::trim_left(left) != (size == 0 ? left : text);
+            untrimmed += sm::trim_right(right) != (size == 0 ? right : text);
+        }
+    }
+    CT_ASSERT(untrimmed, 0, "Trim must remove every run of delimiters");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test CPU's case folding kernels.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cpu_case) {
+    CT_BEGIN;
+
+    auto &baseline = cpu::kernels_for(cpu::isa::baseline);
+
+    for (auto level : supported_isas())
+    {
+        auto       &kernels    = cpu::kernels_for(level);
+        std::size_t mismatches = 0;
+        std::size_t differs    = 0;
+
+        for (std::size_t size = 0; size < 300; size++)
+        {
+            // Offset by a byte to fold unaligned data too
+            std::string input = make_bytes(size + 1, size);
+            std::string lower = input;
+            std::string upper = input;
+            std::string baseline_lower = input;
+            std::string baseline_upper = input;
+
+            kernels.to_lower(lower.data() + 1, input.data() + 1, size);
+            kernels.to_upper(upper.data() + 1, input.data() + 1, size);
+            baseline.to_lower(baseline_lower.data() + 1, input.data() + 1,
+                size);
+            baseline.to_upper(baseline_upper.data() + 1, input.data() + 1,
+                size);
+
+            for (std::size_t i = 1; i <= size; i++)
+            {
+                char c = input[i];
+                mismatches += lower[i] != (c >= 'A' && c <= 'Z' ? c + 32 : c);
+                mismatches += upper[i] != (c >= 'a' && c <= 'z' ? c - 32 : c);
+            }
+
+            differs += lower != baseline_lower;
+            differs += upper != baseline_upper;
+        }
+
+        logln("{}: {} mismatches, {} differences from baseline",
+            cpu::to_string(level), mismatches, differs);
+        CT_ASSERT(mismatches, 0, "Kernels must only fold ASCII letters");
+        CT_ASSERT(differs, 0, "Kernels must fold the same as the baseline");
+    }
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test CPU's checksum kernels.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cpu_crc32c) {
+    CT_BEGIN;
+
+    std::string_view check = "123456789";
+    std::string      data  = make_bytes(1000, 1);
+
+    auto expected = cpu::kernels_for(cpu::isa::baseline).crc32c(0,
+        data.data(), data.size());
+
+    for (auto level : supported_isas())
+    {
+        auto &kernels = cpu::kernels_for(level);
+        logln("{}", cpu::to_string(level));
+
+        CT_ASSERT(kernels.crc32c(0, check.data(), check.size()), 0xE3069283u,
+            "Checksum must be CRC-32C");
+        CT_ASSERT(kernels.crc32c(0, data.data(), data.size()), expected,
+            "Checksum must be the same for every instruction set");
+
+        auto part = kernels.crc32c(0, data.data(), 333);
+        CT_ASSERT(kernels.crc32c(part, data.data() + 333, data.size() - 333),
+            expected, "Checksum must continue");
+
+        // Every size around the kernels' block sizes, at unaligned offsets
+        std::size_t differs = 0;
+        for (std::size_t offset = 0; offset < 8; offset++)
+        {
+            for (std::size_t size = 0; offset + size <= 300; size++)
+            {
+                auto bytes = data.data() + offset;
+                differs   += kernels.crc32c(7, bytes, size)
+                          != cpu::kernels_for(cpu::isa::baseline).crc32c(7,
+                              bytes, size);
+            }
+        }
+        CT_ASSERT(differs, 0, "Checksum must be the same as the baseline");
+    }
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test CPU.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_cpu) try
+{
+    test_case cpu_detection_test_case {
+        .title         = "Test CPU's detection",
+        .function_name = "test_cpu_detection",
+        .function      = test_cpu_detection
+    };
+
+    test_case cpu_search_test_case {
+        .title         = "Test CPU's search kernels against std::string_view",
+        .function_name = "test_cpu_search",
+        .function      = test_cpu_search
+    };
+
+    test_case cpu_case_test_case {
+        .title         = "Test CPU's case folding kernels",
+        .function_name = "test_cpu_case",
+        .function      = test_cpu_case
+    };
+
+    test_case cpu_crc32c_test_case {
+        .title         = "Test CPU's checksum kernels",
+        .function_name = "test_cpu_crc32c",
+        .function      = test_cpu_crc32c
+    };
+
+    test_suite suite = {
+        .tests       = {
+            &cpu_detection_test_case,
+            &cpu_search_test_case,
+            &cpu_case_test_case,
+            &cpu_crc32c_test_case
+        },
+        .pre_run  = default_pre_runner('=', 3),
+        .post_run = default_post_runner('=', 3)
+    };
+
+    auto failed_tests = suite.run();
+    print_failed_tests(failed_tests);
+    return sum_failed_tests_errors(failed_tests);
+}
+catch (const std::exception &e)
+{
+    logln("Exception occurred during test: {}", e.what());
+    return 1;
+}
+catch (...)
+{
+    logln("Unknown exception occurred during test");
+    return 1;
+}
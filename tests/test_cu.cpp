@@ -37,11 +37,20 @@
  *    "Standard".
  */
 
+#include <algorithm>
 #include <cstddef>
+#include <ranges>
+#include <string>
+#include <vector>
 
+#include "confer.hpp"
+
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
 #include "alcelin_container_utilities.hpp"
 #include "alcelin_string_manipulators.hpp"
-#include "confer.hpp"
+#endif
 
 using namespace alcelin;
 using namespace cu_operators;
@@ -71,6 +80,35 @@ using namespace cu_operators;
     CT_END;
 }
 
+/**
+ *  @brief   Test CU's @c slice function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cu_slice) {
+    CT_BEGIN;
+
+    std::vector container = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    std::vector expected  = { 3, 4, 5, 6, 7 };
+
+    auto sliced  = cu::slice(container, 2, 7);
+    auto clamped = cu::slice(container, 8, 20, true);
+    auto outside = cu::slice(container, 15, 20, true);
+
+    logln("container: {}", sm::to_string(container));
+    logln("sliced: {}",    sm::to_string(sliced));
+    logln("clamped: {}",   sm::to_string(clamped));
+    logln("expected: {}",  sm::to_string(expected));
+
+    CT_ASSERT_CTR(std::vector(sliced.begin(), sliced.end()), expected);
+    CT_ASSERT(sliced.data(), container.data() + 2,
+        "Slice must not copy the elements");
+    CT_ASSERT_CTR(std::vector(clamped.begin(), clamped.end()),
+        (std::vector { 9, 10 }));
+    CT_ASSERT(outside.empty(), true, "Slice outside must be empty");
+
+    CT_END;
+}
+
 /**
  *  @brief   Test CU's @c combine function (overload 1).
  *  @return  Number of errors.
@@ -163,6 +201,66 @@ using namespace cu_operators;
     CT_END;
 }
 
+/**
+ *  @brief   Test CU's @c filter_out_occ function with every strategy.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cu_filter_out_occ_strategies) {
+    CT_BEGIN;
+
+    // More values than cu::filter_linear_max, with duplicates
+    std::vector<int> container;
+    std::vector<int> filter;
+    std::vector<int> expected;
+    for (int i = 0; i < 200; i++)
+    {
+        container.emplace_back(i * 37 % 100);
+        if (i % 3 == 0) filter.emplace_back(i % 150);
+    }
+    for (auto element : container)
+    {
+        if (element % 3 != 0) expected.emplace_back(element);
+    }
+
+    std::vector sorted_container = container;
+    std::vector sorted_filter    = filter;
+    std::ranges::sort(sorted_container);
+    std::ranges::sort(sorted_filter);
+    std::vector sorted_expected = expected;
+    std::ranges::sort(sorted_expected);
+
+    std::vector<std::string> strings;
+    std::vector<std::string> string_filter;
+    std::vector<std::string> string_expected;
+    for (auto element : container)
+    {
+        strings.emplace_back(std::to_string(element));
+    }
+    for (auto value : filter)
+    {
+        string_filter.emplace_back(std::to_string(value));
+    }
+    for (auto element : expected)
+    {
+        string_expected.emplace_back(std::to_string(element));
+    }
+
+    for (int i = 0; i < (int)cu::filter_strategy::max; i++)
+    {
+        auto strategy = (cu::filter_strategy)i;
+        logln("strategy: {}", cu::to_string(strategy));
+
+        CT_ASSERT_CTR(cu::filter_out_occ(container, filter, strategy),
+            expected);
+        CT_ASSERT_CTR(cu::filter_out_occ(sorted_container, sorted_filter,
+            strategy), sorted_expected);
+        CT_ASSERT_CTR(cu::filter_out_occ(strings, string_filter, strategy),
+            string_expected);
+    }
+
+    CT_END;
+}
+
 /**
  *  @brief   Test CU's @c filter_out_occ_seq function.
  *  @return  Number of errors.
@@ -364,6 +462,15 @@ using namespace cu_operators;
 
     CT_ASSERT_SUB_SIZE(splitted, expected, 2);
 
+    // Empty patterns are ignored instead of matching everywhere
+    splitter.emplace_back();
+    CT_ASSERT_NEST_CTR(cu::split_occ_seq(container, splitter), expected);
+    CT_ASSERT_NEST_CTR(cu::split_occ_seq_flat(container, splitter)
+        | std::ranges::to<std::vector<std::vector<int>>>(), expected);
+    CT_ASSERT_NEST_CTR(cu::split_occ_seq(container,
+        std::vector<std::vector<int>> { {} }),
+        std::vector<std::vector<int>> { container });
+
     CT_END;
 }
 
@@ -400,6 +507,111 @@ using namespace cu_operators;
     CT_END;
 }
 
+/**
+ *  @brief   Test CU's flat split functions against the nested ones.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cu_split_flat) {
+    CT_BEGIN;
+
+    using nested = std::vector<std::vector<int>>;
+
+    std::vector container = { 4, 1, 2, 3, 3, 4, 5, 6, 7, 8, 8, 9, 10, 4 };
+    std::vector splitter  = { 3, 4 };
+    nested      patterns  = { { 3, 3 }, { 8 } };
+
+    auto seq     = cu::split_seq_flat(container, splitter);
+    auto occ     = cu::split_occ_flat(container, splitter);
+    auto occ_seq = cu::split_occ_seq_flat(container, patterns);
+    auto value   = cu::split_flat(container, 4);
+
+    logln("container: {}", sm::to_string(container));
+    for (std::size_t i = 0; i < occ.size(); i++)
+    {
+        logln("occ[{}]: {}", i, sm::to_string(std::vector<int>(
+            occ[i].begin(), occ[i].end())));
+    }
+
+    CT_ASSERT_NEST_CTR(seq | std::ranges::to<nested>(),
+        cu::split_seq(container, splitter));
+    CT_ASSERT_NEST_CTR(occ | std::ranges::to<nested>(),
+        cu::split_occ(container, splitter));
+    CT_ASSERT_NEST_CTR(occ_seq | std::ranges::to<nested>(),
+        cu::split_occ_seq(container, patterns));
+    CT_ASSERT_NEST_CTR(value | std::ranges::to<nested>(),
+        cu::split(container, 4));
+
+    CT_ASSERT(occ.offsets.capacity(), occ.size(),
+        "Offsets must be reserved exactly");
+    CT_ASSERT(occ.values.capacity(), occ.values.size(),
+        "Values must be reserved exactly");
+    CT_ASSERT(cu::split_occ_flat(std::vector<int>(), splitter).empty(), true,
+        "Empty container must have no pieces");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test CU's @c replace_seq function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cu_replace_seq) {
+    CT_BEGIN;
+
+    std::vector container   = { 1, 2, 3, 1, 2, 1, 1, 2, 4, 1 };
+    std::vector pattern     = { 1, 2 };
+    std::vector replacement = { 7, 8, 9 };
+    std::vector expected    = { 7, 8, 9, 3, 7, 8, 9, 1, 7, 8, 9, 4, 1 };
+
+    auto replaced  = cu::replace_seq(container, pattern, replacement);
+    auto removed   = cu::replace_seq(container, pattern, std::vector<int>());
+    auto unchanged = cu::replace_seq(container, std::vector<int>(),
+        replacement);
+
+    logln("container: {}",   sm::to_string(container));
+    logln("pattern: {}",     sm::to_string(pattern));
+    logln("replacement: {}", sm::to_string(replacement));
+    logln("replaced: {}",    sm::to_string(replaced));
+    logln("expected: {}",    sm::to_string(expected));
+
+    CT_ASSERT_CTR(replaced, expected);
+    CT_ASSERT_CTR(removed, cu::filter_out_seq(container, pattern));
+    CT_ASSERT_CTR(unchanged, container);
+    CT_ASSERT(replaced.capacity(), replaced.size(),
+        "Result must be reserved exactly");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test CU's @c replace_occ function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_cu_replace_occ) {
+    CT_BEGIN;
+
+    std::vector container   = { 1, 2, 3, 4, 5, 3, 2, 1 };
+    std::vector values      = { 2, 3 };
+    std::vector replacement = { 0, 0 };
+    std::vector expected    = { 1, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 1 };
+
+    auto replaced = cu::replace_occ(container, values, replacement);
+    auto removed  = cu::replace_occ(container, values, std::vector<int>());
+
+    logln("container: {}",   sm::to_string(container));
+    logln("values: {}",      sm::to_string(values));
+    logln("replacement: {}", sm::to_string(replacement));
+    logln("replaced: {}",    sm::to_string(replaced));
+    logln("expected: {}",    sm::to_string(expected));
+
+    CT_ASSERT_CTR(replaced, expected);
+    CT_ASSERT_CTR(removed, cu::filter_out_occ(container, values));
+    CT_ASSERT(replaced.capacity(), replaced.size(),
+        "Result must be reserved exactly");
+
+    CT_END;
+}
+
 /**
  *  @brief   Test CU operators' @c operator+ (overload 1).
  *  @return  Number of errors.
@@ -762,6 +974,12 @@ using namespace cu_operators;
         .function      = test_cu_subordinate
     };
 
+    test_case cu_slice_test_case {
+        .title         = "Test CU's slice function",
+        .function_name = "test_cu_slice",
+        .function      = test_cu_slice
+    };
+
     test_case cu_combine_1_test_case {
         .title         = "Test CU's combine function (overload 1)",
         .function_name = "test_cu_combine_1",
@@ -786,6 +1004,13 @@ using namespace cu_operators;
         .function      = test_cu_filter_out_occ
     };
 
+    test_case cu_filter_out_occ_strategies_test_case {
+        .title         = "Test CU's filter_out_occ function with every "
+                         "strategy",
+        .function_name = "test_cu_filter_out_occ_strategies",
+        .function      = test_cu_filter_out_occ_strategies
+    };
+
     test_case cu_filter_out_occ_seq_test_case {
         .title         = "Test CU's filter_out_occ_seq function",
         .function_name = "test_cu_filter_out_occ_seq",
@@ -834,6 +1059,25 @@ using namespace cu_operators;
         .function      = test_cu_split
     };
 
+    test_case cu_split_flat_test_case {
+        .title         = "Test CU's flat split functions against the nested "
+                         "ones",
+        .function_name = "test_cu_split_flat",
+        .function      = test_cu_split_flat
+    };
+
+    test_case cu_replace_seq_test_case {
+        .title         = "Test CU's replace_seq function",
+        .function_name = "test_cu_replace_seq",
+        .function      = test_cu_replace_seq
+    };
+
+    test_case cu_replace_occ_test_case {
+        .title         = "Test CU's replace_occ function",
+        .function_name = "test_cu_replace_occ",
+        .function      = test_cu_replace_occ
+    };
+
     test_case cu_operator_plus_1_test_case {
         .title         = "Test CU operators' operator+ (overload 1)",
         .function_name = "test_cu_operator_plus_1",
@@ -921,11 +1165,13 @@ using namespace cu_operators;
     test_suite suite = {
         .tests       = {
             &cu_subordinate_test_case,
+            &cu_slice_test_case,
             &cu_combine_1_test_case,
             &cu_combine_1_test_case,
             &cu_combine_2_test_case,
             &cu_filter_out_seq_test_case,
             &cu_filter_out_occ_test_case,
+            &cu_filter_out_occ_strategies_test_case,
             &cu_filter_out_occ_seq_test_case,
             &cu_filter_out_test_case,
             &cu_repeat_1_test_case,
@@ -934,6 +1180,9 @@ using namespace cu_operators;
             &cu_split_occ_test_case,
             &cu_split_occ_seq_test_case,
             &cu_split_test_case,
+            &cu_split_flat_test_case,
+            &cu_replace_seq_test_case,
+            &cu_replace_occ_test_case,
             &cu_operator_plus_1_test_case,
             &cu_operator_plus_2_test_case,
             &cu_operator_minus_1_test_case,
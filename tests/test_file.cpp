@@ -43,9 +43,14 @@
 #include <string>
 #include <string_view>
 
+#include "confer.hpp"
+
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
 #include "alcelin_file_utilities.hpp"
 #include "alcelin_string_manipulators.hpp"
-#include "confer.hpp"
+#endif
 
 using namespace alcelin;
 using namespace std::string_literals;
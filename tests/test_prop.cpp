@@ -37,12 +37,26 @@
  *    "Standard".
  */
 
+#include <array>
+#include <cstddef>
 #include <exception>
+#include <functional>
 #include <memory>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
-#include "alcelin_property.hpp"
 #include "confer.hpp"
 
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_property.hpp"
+#endif
+
 using namespace alcelin;
 using namespace std::string_literals;
 
@@ -268,6 +282,164 @@ struct type_with_operators {
     CT_END;
 }
 
+/**
+ *  @brief   Test Prop's property with deduced getter and setter types.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_property_deduced) {
+    CT_BEGIN;
+
+    int prop_value = 42;
+    prop::property prop([&]() {
+        return prop_value;
+    }, [&](const int &value) {
+        logln("Setter called with value: {}", value);
+        prop_value = value;
+    });
+
+    // Stateless storage, no type erasure
+    static_assert(std::is_same_v<decltype(prop), prop::property<int,
+        decltype(prop.getter), decltype(prop.setter), prop::no_modifier>>);
+
+    // uncrustify:off
+    std::vector values = {
+        (int)prop,
+        prop + 1,
+        (int)(prop += 1),
+        (int)(prop *= 2),
+        (int)(prop++),
+        (int)(--prop)
+    };
+
+    std::vector expected = {
+        42, // (int)prop
+        43, // prop + 1
+        43, // (int)(prop += 1)
+        86, // (int)(prop *= 2)
+        86, // (int)(prop++)
+        86  // (int)(--prop)
+    };
+    // uncrustify:on
+
+    CT_ASSERT_CTR(values, expected);
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's property with modifier.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_property_modifier) {
+    CT_BEGIN;
+
+    std::string text         = "";
+    int         setter_count = 0;
+
+    prop::property prop([&]() {
+        return text;
+    }, [&](const std::string &value) {
+        setter_count++;
+        text = value;
+    }, [&](const auto &mutate) {
+        logln("Modifier called");
+        mutate(text);
+    });
+
+    prop += "Hello"s;
+    prop += ", World!"s;
+
+    CT_ASSERT(text, "Hello, World!"s, "Value must be modified in-place");
+    CT_ASSERT(setter_count, 0, "Setter must not be called");
+
+    prop = "Reset"s;
+
+    CT_ASSERT(setter_count, 1, "Assignment must call setter");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's inplace function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_inplace_function) {
+    CT_BEGIN;
+
+    prop::inplace_function<int(int)> empty;
+    CT_ASSERT(!empty, true, "Default constructed function must be empty");
+
+    bool thrown = false;
+    try
+    {
+        (void)empty(1);
+    }
+    catch (const std::bad_function_call &)
+    {
+        thrown = true;
+    }
+    CT_ASSERT(thrown, true, "Calling empty function must throw");
+
+    std::string captured = "captured";
+    prop::inplace_function<std::size_t(std::size_t)> function =
+        [captured](std::size_t offset) {
+        return captured.size() + offset;
+    };
+    auto copy = function;
+
+    CT_ASSERT(function(1), 9uz, "Function must call the stored callable");
+    CT_ASSERT(copy(2), 10uz, "Copy must call its own copy of the callable");
+
+    auto moved = std::move(copy);
+    CT_ASSERT(moved(3), 11uz, "Moved function must call the callable");
+    CT_ASSERT(!copy, true, "Moved from function must be empty");
+
+    // Too large for the internal storage, stored on the heap
+    std::array<std::size_t, 16> large = {};
+    large.back() = 5;
+    prop::inplace_function<std::size_t(std::size_t)> heap =
+        [large](std::size_t offset) {
+        return large.back() + offset;
+    };
+    auto heap_copy  = heap;
+    auto heap_moved = std::move(heap);
+    heap_copy       = std::move(heap_moved);
+
+    CT_ASSERT(heap_copy(1), 6uz, "Large callable must be stored on the heap");
+    CT_ASSERT(!heap && !heap_moved, true,
+        "Moved from functions must be empty");
+    CT_ASSERT(decltype(heap)::stored_inplace<decltype(large)>, false,
+        "Large callable must not be stored inplace");
+
+    // Callables are always called as const
+    struct overloaded {
+        std::array<std::size_t, 16> padding = {};
+        auto operator() () const -> int { return 1; }
+        auto operator() () -> int { return 2; }
+    };
+    prop::inplace_function<int()> inplace_overloaded = [&]() {
+        return overloaded {}();
+    };
+    prop::inplace_function<int()> const_overloaded = overloaded {};
+
+    CT_ASSERT(inplace_overloaded(), 2, "Lambda must call its own body");
+    CT_ASSERT(const_overloaded(), 1, "Callable must be called as const");
+
+    // Usable in constant evaluation, like the rest of the properties
+    constexpr int evaluated = []() {
+        int                 value = 1;
+        prop::property<int> property([&]() { return value; },
+            [&](const int &set) { value = set; });
+
+        auto copy  = property;
+        copy      += 2;
+        return property.get() * 10 + value;
+    }();
+    CT_ASSERT(evaluated, 33, "Property must be usable in constant evaluation");
+
+    CT_END;
+}
+
 /**
  *  @brief   Test Prop's observable.
  *  @return  Number of errors.
@@ -302,6 +474,526 @@ struct type_with_operators {
 
     CT_ASSERT(observed_count, expected_count, "Observer counter must match");
 
+    // Setting the value to itself, while keeping the old value
+    prop::observable<std::string> string = std::string("unchanged");
+    std::string                   transitioned_old;
+    string.transitioned.connect([&](const std::string &old,
+        const std::string &) {
+        transitioned_old = old;
+    });
+
+    string = string.get();
+
+    CT_ASSERT(string.get(), std::string("unchanged"),
+        "Self-assignment must keep the value");
+    CT_ASSERT(transitioned_old, std::string("unchanged"),
+        "Self-assignment must keep the old value");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's observable copied and moved by value.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_observable_copy) {
+    CT_BEGIN;
+
+    int observed_count = 0;
+    std::vector<prop::observable<int>> observables;
+
+    // Reallocation moves the observables around
+    for (int i = 0; i < 100; i++)
+    {
+        observables.emplace_back([&](int) {
+            observed_count++;
+        });
+        observables.back().value = i;
+    }
+
+    for (auto &observable : observables)
+    {
+        observable += 1;
+    }
+
+    CT_ASSERT(observed_count, 100, "Observer counter must match");
+    CT_ASSERT((int)observables[42], 43, "Moved observable must keep value");
+
+    auto copy = observables[42];
+    copy = 0;
+
+    CT_ASSERT((int)observables[42], 43,
+        "Modifying copy must not modify original");
+    CT_ASSERT((int)copy, 0, "Copy must hold its own value");
+
+    // Slots capture the original, copies and moves must not reach them
+    int                   changed_count = 0;
+    prop::observable<int> original      = 1;
+    prop::journal         journal(4096);
+    original.changed.connect([&](const int &) { changed_count++; });
+    original.transitioned.connect([&](const int &, const int &) {
+        changed_count++;
+    });
+    journal.track(original);
+
+    auto copied = original;
+    copied      = 99;
+    auto moved  = std::move(copied);
+    moved      += 1;
+    copied      = original;
+    copied      = 7;
+
+    CT_ASSERT(changed_count, 0, "Copy must not notify original's slots");
+    CT_ASSERT(journal.undo_size(), 0, "Copy must not be journaled");
+    CT_ASSERT(copied.changed.size() + moved.changed.size(), 0uz,
+        "Copies must start without slots");
+
+    original = 2;
+    CT_ASSERT(changed_count, 2, "Original must keep its slots");
+
+    int              external       = 0;
+    int              proxy_count    = 0;
+    prop::proxy<int> proxy          = &external;
+    proxy.changed.connect([&](const int &) { proxy_count++; });
+
+    auto proxy_copy = proxy;
+    proxy_copy      = 5;
+
+    CT_ASSERT(proxy_count, 0, "Proxy copy must not notify original's slots");
+    CT_ASSERT(external, 5, "Proxy copy must control the same value");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's signal.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_signal) {
+    CT_BEGIN;
+
+    prop::observable<int> observable;
+    int                   sum = 0;
+
+    auto first = observable.changed.connect([&](const int &value) {
+        logln("First slot called with value: {}", value);
+        sum += value;
+    });
+
+    // Disconnects itself and connects another slot during emission
+    prop::connection second;
+    second = observable.changed.connect([&](const int &value) {
+        logln("Second slot called with value: {}", value);
+        sum += value * 10;
+        observable.changed.disconnect(second);
+        observable.changed.connect([&](const int &value) {
+            logln("Third slot called with value: {}", value);
+            sum += value * 100;
+        });
+    });
+
+    observable = 1;
+    CT_ASSERT(sum, 11, "Slot connected during emission must not be called");
+
+    observable = 1;
+    CT_ASSERT(sum, 112, "Disconnected slot must not be called");
+
+    CT_ASSERT(observable.changed.is_connected(first), true,
+        "First slot must be connected");
+    CT_ASSERT(observable.changed.is_connected(second), false,
+        "Second slot must be disconnected");
+
+    // Free slot is reused, stale handle must not disconnect it
+    auto reused = observable.changed.connect([&](const int &) {});
+    CT_ASSERT(reused.index, second.index, "Free slot must be reused");
+    CT_ASSERT(observable.changed.disconnect(second), false,
+        "Stale handle must not disconnect reused slot");
+    CT_ASSERT(observable.changed.size(), 3uz, "Slot count must match");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's batch.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_batch) {
+    CT_BEGIN;
+
+    int observed_count     = 0;
+    int transitioned_count = 0;
+    std::vector<prop::observable<int>> observables(50);
+
+    for (auto &observable : observables)
+    {
+        observable.observer = [&](const int &) {
+            observed_count++;
+        };
+        observable.transitioned.connect([&](const int &old, const int &value) {
+            logln("Transitioned from {} to {}", old, value);
+            transitioned_count++;
+        });
+    }
+
+    {
+        prop::batch batch;
+        for (auto &observable : observables)
+        {
+            observable += 1;
+            observable *= 2;
+        }
+
+        // Net change is none
+        observables[0] = 0;
+
+        CT_ASSERT(observed_count, 0, "Observers must be deferred in batch");
+    }
+
+    CT_ASSERT(observed_count, 49, "Observers must be called once per change");
+    CT_ASSERT(transitioned_count, 49,
+        "Transitioned must be emitted once per change");
+
+    // Suppress unchanged values outside of batch
+    prop::observable<int> observable;
+    observable.skip_unchanged = true;
+    observable.observer       = [&](const int &) {
+        observed_count++;
+    };
+
+    observable = 0;
+    observable = 1;
+    observable = 1;
+
+    CT_ASSERT(observed_count, 50, "Unchanged values must be skipped");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's computed property.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_computed) {
+    CT_BEGIN;
+
+    prop::observable<int> width  = 2;
+    prop::observable<int> height = 3;
+    int computed_count = 0;
+
+    prop::computed area([&]() {
+        logln("Area computed");
+        computed_count++;
+        return width * height;
+    });
+    prop::computed perimeter_area([&]() {
+        return area.get() * 2;
+    });
+
+    // uncrustify:off
+    std::vector values = {
+        (int)area,
+        (int)area,
+        (int)perimeter_area,
+        (int)(width = 4),
+        (int)perimeter_area,
+        (int)area
+    };
+
+    std::vector expected = {
+        6,  // (int)area
+        6,  // (int)area
+        12, // (int)perimeter_area
+        4,  // (int)(width = 4)
+        24, // (int)perimeter_area
+        12  // (int)area
+    };
+    // uncrustify:on
+
+    CT_ASSERT_CTR(values, expected);
+    CT_ASSERT(computed_count, 2, "Area must be computed once per change");
+    CT_ASSERT(area.hits, 3uz, "Cache hits must match");
+    CT_ASSERT(area.misses, 2uz, "Cache misses must match");
+
+    // Observers see up-to-date computed properties
+    int observed_area = 0;
+    height.observer = [&](const int &) {
+        observed_area = area;
+    };
+    height = 5;
+
+    CT_ASSERT(observed_area, 20, "Observer must see recomputed area");
+
+    // Reallocation destroys the tracked observable
+    std::vector<prop::observable<int>> observables;
+    observables.emplace_back(1);
+    {
+        prop::computed first([&]() { return observables[0].get() * 10; });
+        CT_ASSERT(first.get(), 10, "Computed must read the first element");
+
+        observables.reserve(observables.capacity() + 1);
+        observables.emplace_back(2);
+
+        CT_ASSERT(first.dirty, true, "Destroyed dependency must mark dirty");
+        CT_ASSERT(first.sources.size(), 0uz,
+            "Destroyed dependency must be forgotten");
+
+        observables[0] = 3;
+        CT_ASSERT(first.get(), 30, "Computed must track the moved element");
+    }
+    observables[0] = 4;
+
+    CT_ASSERT(observables[0].invalidated.dependents.size(), 0uz,
+        "Destroyed computed must leave no dependents");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's atomic observable.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_atomic_observable) {
+    CT_BEGIN;
+
+    /**
+     *  @brief  Type too large to be lock-free, stored in a seqlock.
+     */
+    struct large_type {
+        long a = 0, b = 0, c = 0, d = 0;
+    };
+
+    prop::task_queue                    tasks;
+    prop::atomic_observable<int>        counter;
+    prop::atomic_observable<large_type> large;
+    int observed_value = 0;
+
+    prop::atomic_observable<int> published([&](const int &value) {
+        observed_value = value;
+    }, tasks.executor());
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; i++)
+    {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < 10'000; j++)
+            {
+                counter += 1;
+                large.apply([&](large_type &value) {
+                    value.a++;
+                    value.b++;
+                    value.c++;
+                    value.d++;
+                });
+            }
+        });
+    }
+    for (auto &thread : threads) thread.join();
+
+    large_type large_value = large;
+
+    CT_ASSERT((int)counter, 40'000, "Atomic increments must not be lost");
+    CT_ASSERT(large_value.a, 40'000l, "Seqlock updates must not be lost");
+    CT_ASSERT(large_value.d, large_value.a, "Seqlock value must not tear");
+
+    std::thread([&]() { published = 42; }).join();
+
+    CT_ASSERT(observed_value, 0, "Observer must wait for executor");
+    CT_ASSERT(tasks.run(), 1uz, "One notification must be posted");
+    CT_ASSERT(observed_value, 42, "Observer must be called by executor");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's observable containers.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_observable_containers) {
+    CT_BEGIN;
+
+    prop::observable_vector<int> vector = { 1, 2, 3 };
+    std::vector<std::size_t>     changes;
+
+    vector.changed.connect([&](const prop::vector_change &change) {
+        logln("Vector change: {} from {} count {}",
+            prop::to_string(change.kind), change.first, change.count);
+        changes.insert(changes.end(), { (std::size_t)change.kind,
+                                        change.first, change.count });
+    });
+
+    std::vector<int> inserted = { 5, 6 };
+    vector.push_back(4);
+    vector.insert(1, inserted.begin(), inserted.end());
+    vector.erase(0, 2);
+    vector.modify(0, 2, [&](int &value) { value *= 10; });
+
+    // uncrustify:off
+    std::vector<std::size_t> expected_changes = {
+        (std::size_t)prop::change_kind::insert, 3, 1,
+        (std::size_t)prop::change_kind::insert, 1, 2,
+        (std::size_t)prop::change_kind::erase,  0, 2,
+        (std::size_t)prop::change_kind::update, 0, 2
+    };
+    // uncrustify:on
+
+    std::vector expected_values = { 60, 20, 3, 4 };
+
+    CT_ASSERT_CTR(changes, expected_changes);
+    CT_ASSERT_CTR(vector.get(), expected_values);
+
+    prop::observable_map<std::string, int> map;
+    std::vector<std::string>               keys;
+
+    map.changed.connect([&](const prop::map_change<std::string> &change) {
+        keys.emplace_back(prop::to_string(change.kind) + " "
+            + (change.key ? *change.key : ""));
+    });
+
+    map.set("a", 1);
+    map.set("a", 2);
+    map.modify("a", [&](int &value) { value++; });
+    map.erase("a");
+    map.clear();
+
+    std::vector<std::string> expected_keys = {
+        "insert a", "update a", "update a", "erase a", "clear "
+    };
+
+    CT_ASSERT_CTR(keys, expected_keys);
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's registry.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_registry) {
+    CT_BEGIN;
+
+    prop::observable<int>         volume = 5;
+    prop::observable<float>       gain   = 1.5f;
+    prop::observable<std::string> title; // Not trivially copyable
+
+    prop::registry registry;
+    registry.add("volume", volume);
+    registry.add("gain", gain);
+    registry.add("title", title);
+
+    CT_ASSERT(registry.size(), 3, "Incorrect number of properties");
+    CT_ASSERT(registry.contains(std::string_view("gain")), true,
+        "Registered property not found");
+    CT_ASSERT(registry.contains("missing"), false,
+        "Unregistered property found");
+
+    std::stringstream stream;
+    CT_ASSERT(registry.save(stream), 2, "Incorrect number of saved properties");
+    CT_ASSERT(registry.autosave(stream), 0,
+        "Unchanged properties were autosaved");
+
+    volume = 10;
+    CT_ASSERT(registry.autosave(stream), 1,
+        "Incorrect number of autosaved properties");
+
+    volume = 0;
+    gain   = 0.0f;
+
+    CT_ASSERT(registry.restore_all(stream), 2, "Incorrect number of chunks");
+    CT_ASSERT(volume.get(), 10, "Incorrect restored volume");
+    CT_ASSERT(gain.get(), 1.5f, "Incorrect restored gain");
+    CT_ASSERT(registry.find("volume")->dirty, false,
+        "Restored property is dirty");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Prop's journal.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_prop_journal) {
+    CT_BEGIN;
+
+    prop::observable<int> position = 0;
+    double                raw      = 1.0;
+    prop::property        speed    = {
+        [&]() { return raw; },
+        [&](const double &value) { raw = value; }
+    };
+
+    prop::journal journal(4096);
+    journal.track(position);
+    journal.track(speed);
+
+    journal.begin_frame();
+    position = 10;
+    position = 20;
+    journal.set(speed, 2.0);
+    journal.end_frame();
+    position = 30;
+
+    CT_ASSERT(journal.undo_size(), 4, "Incorrect number of records");
+    CT_ASSERT(journal.undo(), 1, "Incorrect number of changes undone");
+    CT_ASSERT(position.get(), 20, "Incorrect position after undo");
+    CT_ASSERT(journal.undo(), 3, "Incorrect number of changes undone");
+    CT_ASSERT(position.get(), 0, "Incorrect position after frame undo");
+    CT_ASSERT(raw, 1.0, "Incorrect speed after frame undo");
+    CT_ASSERT(journal.redo(), 3, "Incorrect number of changes redone");
+    CT_ASSERT(position.get(), 20, "Incorrect position after frame redo");
+
+    position = 5;
+    CT_ASSERT(journal.redo_size(), 0, "Redo not dropped after change");
+    CT_ASSERT(journal.rewind(), 4, "Incorrect number of changes rewound");
+    CT_ASSERT(journal.replay(), 4, "Incorrect number of changes replayed");
+    CT_ASSERT(position.get(), 5, "Incorrect position after replay");
+
+    // Bounded memory, oldest records are dropped
+    prop::observable<int> counter = 0;
+    prop::journal         bounded(100);
+    bounded.track(counter);
+    for (int i = 1; i <= 50; i++) counter = i;
+
+    logln("Bounded journal: {} records in {} bytes, {} dropped",
+        bounded.undo_size(), bounded.used, bounded.dropped);
+
+    CT_ASSERT(bounded.used <= bounded.capacity(), true,
+        "Journal exceeded its capacity");
+    CT_ASSERT(bounded.undo_size() + bounded.dropped, 50,
+        "Incorrect number of records");
+
+    std::size_t rewound = bounded.rewind();
+    CT_ASSERT(counter.get(), 50 - (int)rewound,
+        "Incorrect counter after rewind");
+
+    // Values that are not trivially copyable are stored in owned slots
+    prop::observable<std::string> title("untitled");
+    prop::journal                 titles(256);
+    titles.track(title);
+
+    titles.begin_frame();
+    title = "draft";
+    title = "a title too long for the small string optimization";
+    titles.end_frame();
+    title = "final";
+
+    CT_ASSERT(titles.undo(), 1, "Incorrect number of changes undone");
+    CT_ASSERT(title.get(), "a title too long for the small string "
+        "optimization", "Incorrect title after undo");
+    CT_ASSERT(titles.undo(), 2, "Incorrect number of changes undone");
+    CT_ASSERT(title.get(), "untitled", "Incorrect title after frame undo");
+    CT_ASSERT(titles.redo(), 2, "Incorrect number of changes redone");
+    CT_ASSERT(title.get(), "a title too long for the small string "
+        "optimization", "Incorrect title after frame redo");
+
+    // Redo is dropped, and the oldest records once the arena is full
+    for (int i = 0; i < 50; i++) title = std::to_string(i);
+    CT_ASSERT(titles.used <= titles.capacity(), true,
+        "Journal exceeded its capacity");
+    CT_ASSERT(titles.redo_size(), 0, "Redo not dropped after change");
+    CT_ASSERT(titles.dropped > 0, true, "Oldest records not dropped");
+    CT_ASSERT(titles.undo(), 1, "Incorrect number of changes undone");
+    CT_ASSERT(title.get(), "48", "Incorrect title after undo");
+
     CT_END;
 }
 
@@ -360,12 +1052,79 @@ struct type_with_operators {
         .function      = test_prop_property_additional_operators
     };
 
+    test_case prop_property_deduced_test_case {
+        .title         = "Test Prop's property with deduced getter and setter "
+                         "types",
+        .function_name = "test_prop_property_deduced",
+        .function      = test_prop_property_deduced
+    };
+
+    test_case prop_property_modifier_test_case {
+        .title         = "Test Prop's property with modifier",
+        .function_name = "test_prop_property_modifier",
+        .function      = test_prop_property_modifier
+    };
+
+    test_case prop_inplace_function_test_case {
+        .title         = "Test Prop's inplace function",
+        .function_name = "test_prop_inplace_function",
+        .function      = test_prop_inplace_function
+    };
+
     test_case prop_observable_test_case {
         .title         = "Test Prop's observable",
         .function_name = "test_prop_observable",
         .function      = test_prop_observable
     };
 
+    test_case prop_observable_copy_test_case {
+        .title         = "Test Prop's observable copied and moved by value",
+        .function_name = "test_prop_observable_copy",
+        .function      = test_prop_observable_copy
+    };
+
+    test_case prop_signal_test_case {
+        .title         = "Test Prop's signal",
+        .function_name = "test_prop_signal",
+        .function      = test_prop_signal
+    };
+
+    test_case prop_batch_test_case {
+        .title         = "Test Prop's batch",
+        .function_name = "test_prop_batch",
+        .function      = test_prop_batch
+    };
+
+    test_case prop_computed_test_case {
+        .title         = "Test Prop's computed property",
+        .function_name = "test_prop_computed",
+        .function      = test_prop_computed
+    };
+
+    test_case prop_atomic_observable_test_case {
+        .title         = "Test Prop's atomic observable",
+        .function_name = "test_prop_atomic_observable",
+        .function      = test_prop_atomic_observable
+    };
+
+    test_case prop_observable_containers_test_case {
+        .title         = "Test Prop's observable containers",
+        .function_name = "test_prop_observable_containers",
+        .function      = test_prop_observable_containers
+    };
+
+    test_case prop_registry_test_case {
+        .title         = "Test Prop's registry",
+        .function_name = "test_prop_registry",
+        .function      = test_prop_registry
+    };
+
+    test_case prop_journal_test_case {
+        .title         = "Test Prop's journal",
+        .function_name = "test_prop_journal",
+        .function      = test_prop_journal
+    };
+
     test_case prop_proxy_test_case {
         .title         = "Test Prop's proxy",
         .function_name = "test_prop_proxy",
@@ -377,7 +1136,18 @@ struct type_with_operators {
             &prop_property_readonly_test_case,
             &prop_property_test_case,
             &prop_property_additional_operators_test_case,
+            &prop_property_deduced_test_case,
+            &prop_property_modifier_test_case,
+            &prop_inplace_function_test_case,
             &prop_observable_test_case,
+            &prop_observable_copy_test_case,
+            &prop_signal_test_case,
+            &prop_batch_test_case,
+            &prop_computed_test_case,
+            &prop_atomic_observable_test_case,
+            &prop_observable_containers_test_case,
+            &prop_registry_test_case,
+            &prop_journal_test_case,
             &prop_proxy_test_case
         },
         .pre_run  = default_pre_runner('=', 3),
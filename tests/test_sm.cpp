@@ -40,12 +40,19 @@
 #include <cstddef>
 #include <format>
 #include <limits>
+#include <ranges>
 #include <string>
 #include <string_view>
+#include <vector>
 
-#include "alcelin_string_manipulators.hpp"
 #include "confer.hpp"
 
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_string_manipulators.hpp"
+#endif
+
 using namespace alcelin;
 using namespace sm_operators;
 using namespace std::string_literals;
@@ -313,6 +320,156 @@ using namespace std::string_view_literals;
     CT_END;
 }
 
+/**
+ *  @brief   Test SM's flat split functions against the nested ones.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_sm_split_flat) {
+    CT_BEGIN;
+
+    std::string string = "Hello, World!  Split me, flat, please.,";
+    std::vector<std::string> patterns = { ", ", "  " };
+
+    auto seq     = sm::split_seq_flat(string, ", ");
+    auto occ     = sm::split_occ_flat(string, " ,");
+    auto occ_seq = sm::split_occ_seq_flat(string, patterns);
+    auto value   = sm::split_flat(string, ' ');
+
+    logln("string: {}", string);
+    for (std::size_t i = 0; i < occ.size(); i++)
+    {
+        logln("occ[{}]: {}", i, occ[i]);
+    }
+
+    CT_ASSERT_NEST_CTR(seq | std::ranges::to<std::vector<std::string>>(),
+        sm::split_seq(string, ", "));
+    CT_ASSERT_NEST_CTR(occ | std::ranges::to<std::vector<std::string>>(),
+        sm::split_occ(string, " ,"));
+    CT_ASSERT_NEST_CTR(occ_seq | std::ranges::to<std::vector<std::string>>(),
+        sm::split_occ_seq(string, patterns));
+    CT_ASSERT_NEST_CTR(value | std::ranges::to<std::vector<std::string>>(),
+        sm::split(string, ' '));
+    CT_ASSERT(value[1], std::string_view("World!"),
+        "Pieces must be string views");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test SM's @c replace function.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_sm_replace) {
+    CT_BEGIN;
+
+    std::string string   = "Hello, World!  Hello, again!";
+    std::string expected = "Goodbye, World!  Hello, again!";
+
+    auto replaced = sm::replace(string, "Hello", "Goodbye");
+
+    logln("string: {}",   string);
+    logln("replaced: {}", replaced);
+    logln("expected: {}", expected);
+
+    CT_ASSERT_CTR(replaced, expected);
+    CT_ASSERT_CTR(sm::replace(string, "Nope", "Goodbye"), string);
+    CT_ASSERT_CTR(sm::replace(string, "", "Goodbye"), string);
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test SM's @c replace_all function (overload 1).
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_sm_replace_all_1) {
+    CT_BEGIN;
+
+    std::string string   = "one two  three   four";
+    std::string expected = "one_two__three___four";
+
+    auto replaced = sm::replace_all(string, " ", "_");
+    auto grown    = sm::replace_all("aaaaa", "aa", "bbb");
+
+    logln("string: {}",   string);
+    logln("replaced: {}", replaced);
+    logln("expected: {}", expected);
+    logln("grown: {}",    grown);
+
+    CT_ASSERT_CTR(replaced, expected);
+    CT_ASSERT_CTR(grown, std::string("bbbbbba"));
+    CT_ASSERT_CTR(sm::replace_all(string, "  ", ""),
+        std::string("one twothree four"));
+    CT_ASSERT_CTR(sm::replace_all(string, "", "_"), string);
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test SM's @c replace_all function (overload 2).
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_sm_replace_all_2) {
+    CT_BEGIN;
+
+    sm::replace_table table = {
+        { "&", "&amp;" }, { "<", "&lt;" }, { ">", "&gt;" },
+        { "<<", "&laquo;" }, { "", "empty" }, { "&", "ignored" }
+    };
+
+    std::string string   = "a << b && c < d > e";
+    std::string expected = "a &laquo; b &amp;&amp; c &lt; d &gt; e";
+
+    auto replaced = sm::replace_all(string, table);
+
+    std::vector<std::pair<std::string, std::string>> pairs = {
+        { "b", "a" }, { "a", "b" }
+    };
+    auto swapped = sm::replace_all("abba", sm::replace_table(pairs));
+
+    logln("string: {}",   string);
+    logln("replaced: {}", replaced);
+    logln("expected: {}", expected);
+    logln("swapped: {}",  swapped);
+
+    CT_ASSERT_CTR(replaced, expected);
+    CT_ASSERT_CTR(swapped, std::string("baab"));
+    CT_ASSERT_CTR(sm::replace_all("", table), std::string());
+    CT_ASSERT(table.pairs.size(), 4uz, "Empty and repeated patterns must "
+        "be ignored");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test SM's compile time split functions against the runtime ones.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] static CT_TESTER_FN(test_sm_static_split) {
+    CT_BEGIN;
+
+    constexpr auto value = sm::static_split<"if,else,,while,", ','>();
+    constexpr auto seq   = sm::static_split_seq<"a, b,, c, ", ", ">();
+    constexpr auto occ   = sm::static_split_occ<"a b,c,,d,", " ,">();
+    constexpr auto empty = sm::static_split<"", ','>();
+    static_assert(value.size() == 5 && value[3] == "while");
+
+    for (std::size_t i = 0; i < value.size(); i++)
+    {
+        logln("value[{}]: {}", i, value[i]);
+    }
+
+    CT_ASSERT_NEST_CTR(value | std::ranges::to<std::vector<std::string>>(),
+        sm::split("if,else,,while,", ','));
+    CT_ASSERT_NEST_CTR(seq | std::ranges::to<std::vector<std::string>>(),
+        sm::split_seq("a, b,, c, ", ", "));
+    CT_ASSERT_NEST_CTR(occ | std::ranges::to<std::vector<std::string>>(),
+        sm::split_occ("a b,c,,d,", " ,"));
+    CT_ASSERT(empty.size(), 0uz, "Empty literal must have no pieces");
+
+    CT_END;
+}
+
 /**
  *  @brief   Test SM operators' @c operator- (overload 1).
  *  @return  Number of errors.
@@ -661,6 +818,38 @@ using namespace std::string_view_literals;
         .function      = test_sm_is_equal_ins_2
     };
 
+    test_case sm_split_flat_test_case {
+        .title         = "Test SM's flat split functions against the nested "
+                         "ones",
+        .function_name = "test_sm_split_flat",
+        .function      = test_sm_split_flat
+    };
+
+    test_case sm_replace_test_case {
+        .title         = "Test SM's replace function",
+        .function_name = "test_sm_replace",
+        .function      = test_sm_replace
+    };
+
+    test_case sm_replace_all_1_test_case {
+        .title         = "Test SM's replace_all function (overload 1)",
+        .function_name = "test_sm_replace_all_1",
+        .function      = test_sm_replace_all_1
+    };
+
+    test_case sm_replace_all_2_test_case {
+        .title         = "Test SM's replace_all function (overload 2)",
+        .function_name = "test_sm_replace_all_2",
+        .function      = test_sm_replace_all_2
+    };
+
+    test_case sm_static_split_test_case {
+        .title         = "Test SM's compile time split functions against the "
+                         "runtime ones",
+        .function_name = "test_sm_static_split",
+        .function      = test_sm_static_split
+    };
+
     test_case sm_operator_minus_1_test_case {
         .title         = "Test SM operators' operator- (overload 1)",
         .function_name = "test_sm_operator_minus_1",
@@ -733,6 +922,11 @@ using namespace std::string_view_literals;
             &sm_to_lower_2_test_case,
             &sm_is_equal_ins_1_test_case,
             &sm_is_equal_ins_2_test_case,
+            &sm_split_flat_test_case,
+            &sm_replace_test_case,
+            &sm_replace_all_1_test_case,
+            &sm_replace_all_2_test_case,
+            &sm_static_split_test_case,
             &sm_operator_minus_1_test_case,
             &sm_operator_minus_2_test_case,
             &sm_operator_star_1_test_case,
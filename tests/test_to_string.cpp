@@ -41,10 +41,16 @@
 #include <format>
 #include <string>
 #include <string_view>
+#include <vector>
 
-#include "alcelin_string_manipulators.hpp"
 #include "confer.hpp"
 
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_string_manipulators.hpp"
+#endif
+
 using namespace alcelin;
 using namespace std::string_literals;
 
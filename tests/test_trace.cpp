@@ -0,0 +1,220 @@
+/**
+ *  @author  Anstro Pleuton (https://github.com/anstropleuton)
+ *  @brief   Test all of Trace in Alcelin.
+ *
+ *  @copyright  Copyright (c) 2024 Anstro Pleuton
+ *
+ *      _    _          _ _
+ *     / \  | | ___ ___| (_)_ __
+ *    / _ \ | |/ __/ _ \ | | '_ \
+ *   / ___ \| | (_|  __/ | | | | |
+ *  /_/   \_\_|\___\___|_|_|_| |_|
+ *
+ *  Alcelin is a collection of utils for Anstro Pleuton's programs.
+ *
+ *  This software is licensed under the terms of MIT License.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to
+ *  deal in the Software without restriction, including without limitation the
+ *  rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ *  sell copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.  IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ *  FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+ *  IN THE SOFTWARE.
+ *
+ *  Credits where credit's due:
+ *  - ASCII Art generated using https://www.patorjk.com/software/taag with font
+ *    "Standard".
+ */
+
+#include <cstddef>
+#include <exception>
+#include <format>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include "confer.hpp"
+
+#ifdef ALCELIN_TESTS_USE_MODULE
+import alcelin;
+#else
+#include "alcelin_string_manipulators.hpp"
+#include "alcelin_trace.hpp"
+#endif
+
+using namespace alcelin;
+
+/**
+ *  @brief   Get the thread ID of a zone from exported JSON.
+ *
+ *  @param   json  Exported JSON.
+ *  @param   name  Zone name.
+ *  @return  Thread ID as string, empty if the zone is not found.
+ */
+[[nodiscard]] static auto zone_thread(
+    std::string_view json,
+    std::string_view name
+) -> std::string_view
+{
+    auto zone = json.find(std::format("\"name\":\"{}\"", name));
+    if (zone == std::string_view::npos) return {};
+
+    auto tid = json.find("\"tid\":", zone) + 6;
+    return json.substr(tid, json.find('}', tid) - tid);
+}
+
+/**
+ *  @brief   Test Trace's zones and export.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_trace_zones) {
+    CT_BEGIN;
+
+    trace::clear();
+    trace::start();
+    {
+        trace::zone zone("test::zone");
+        auto        split = sm::split("Hello, World!", ',');
+    }
+    trace::stop();
+    {
+        trace::zone zone("test::stopped");
+    }
+
+    std::stringstream json;
+    auto written = trace::write_chrome_json(json);
+    logln("json: {}", json.str());
+
+    CT_ASSERT(json.str().contains("\"traceEvents\":["), true,
+        "Export must be in Chrome's trace event format");
+    CT_ASSERT(json.str().contains("test::stopped"), false,
+        "Zones must not be recorded after stop");
+
+    if constexpr (trace::instrumented)
+    {
+        CT_ASSERT(written >= 3, true, "Zone, sm::split and the nested cu "
+            "calls must be written");
+        CT_ASSERT(json.str().contains("\"name\":\"sm::split\",\"cat\":"
+            "\"alcelin\",\"ph\":\"X\""), true,
+            "Alcelin's functions must be traced");
+        CT_ASSERT(json.str().contains("\"name\":\"cu::split\""), true,
+            "Nested calls must be traced");
+        CT_ASSERT(json.str().contains("test::zone"), true,
+            "Zone must be traced");
+    }
+    else
+    {
+        CT_ASSERT(written, 1, "Only zones used directly are recorded if not "
+            "instrumented");
+    }
+
+    // Names are escaped into valid JSON strings
+    trace::clear();
+    trace::start();
+    {
+        trace::zone zone("test::\"escaped\"\\\n\t\x01");
+    }
+    trace::stop();
+    json.str("");
+    CT_ASSERT(trace::write_chrome_json(json), 1, "Zone must be written");
+    CT_ASSERT(json.str().contains(
+        "\"name\":\"test::\\\"escaped\\\"\\\\\\n\\t\\u0001\""), true,
+        "Quotes, backslashes and control characters must be escaped");
+
+    trace::clear();
+    json.str("");
+    CT_ASSERT(trace::write_chrome_json(json), 0, "Clear must remove zones");
+    CT_ASSERT(trace::dropped(), 0, "Nothing must be dropped");
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Trace's per-thread buffers.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_trace_threads) {
+    CT_BEGIN;
+
+    trace::clear();
+    trace::start();
+    {
+        trace::zone zone("test::main");
+        std::thread thread([] {
+            trace::zone zone("test::thread");
+        });
+        thread.join();
+    }
+    trace::stop();
+
+    std::stringstream json;
+    auto written = trace::write_chrome_json(json);
+    logln("json: {}", json.str());
+
+    auto main_thread  = zone_thread(json.str(), "test::main");
+    auto other_thread = zone_thread(json.str(), "test::thread");
+
+    CT_ASSERT(written, 2, "Zones of both threads must be written");
+    CT_ASSERT(main_thread.empty(), false, "Main thread's zone must be found");
+    CT_ASSERT(other_thread.empty(), false, "Thread's zone must be found");
+    CT_ASSERT(main_thread != other_thread, true,
+        "Threads must have their own IDs");
+
+    trace::clear();
+
+    CT_END;
+}
+
+/**
+ *  @brief   Test Trace.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_trace) try
+{
+    test_case trace_zones_test_case {
+        .title         = "Test Trace's zones and export",
+        .function_name = "test_trace_zones",
+        .function      = test_trace_zones
+    };
+
+    test_case trace_threads_test_case {
+        .title         = "Test Trace's per-thread buffers",
+        .function_name = "test_trace_threads",
+        .function      = test_trace_threads
+    };
+
+    test_suite suite = {
+        .tests       = {
+            &trace_zones_test_case,
+            &trace_threads_test_case
+        },
+        .pre_run  = default_pre_runner('=', 3),
+        .post_run = default_post_runner('=', 3)
+    };
+
+    auto failed_tests = suite.run();
+    print_failed_tests(failed_tests);
+    return sum_failed_tests_errors(failed_tests);
+}
+catch (const std::exception &e)
+{
+    logln("Exception occurred during test: {}", e.what());
+    return 1;
+}
+catch (...)
+{
+    logln("Unknown exception occurred during test");
+    return 1;
+}
@@ -83,6 +83,24 @@
  */
 [[nodiscard]] CT_TESTER_FN(test_prop);
 
+/**
+ *  @brief   Test AC.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_ac);
+
+/**
+ *  @brief   Test Trace.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_trace);
+
+/**
+ *  @brief   Test CPU.
+ *  @return  Number of errors.
+ */
+[[nodiscard]] CT_TESTER_FN(test_cpu);
+
 /**
  *  @brief   The biggie.
  *  @return  Zero on success.
@@ -129,13 +147,34 @@ auto main() -> int try
         .function       = test_prop
     };
 
+    test_case ac_test_case = {
+        .title          = "Test AC",
+        .function_name  = "test_ac",
+        .function       = test_ac
+    };
+
+    test_case trace_test_case = {
+        .title          = "Test Trace",
+        .function_name  = "test_trace",
+        .function       = test_trace
+    };
+
+    test_case cpu_test_case = {
+        .title          = "Test CPU",
+        .function_name  = "test_cpu",
+        .function       = test_cpu
+    };
+
     test_suite suite = {
         .tests       = {
             &cu_test_case,
             &sm_test_case,
             &aec_test_case,
             &file_test_case,
-            &prop_test_case
+            &prop_test_case,
+            &ac_test_case,
+            &trace_test_case,
+            &cpu_test_case
         },
         .pre_run     = [&](const test_case *test) {
             log_file.open(test->function_name + ".log");